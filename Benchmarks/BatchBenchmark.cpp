@@ -0,0 +1,203 @@
+/*
+  ==============================================================================
+
+    BatchBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    FlangerBatchBenchmark: throughput of many independent mono streams,
+    processed by one FlangerCore each or as the lanes of a FlangerBatch,
+    for a range of stream counts and block sizes. JUCE-free, like
+    FlangerGolden.
+
+        FlangerBatchBenchmark [--interpol=0] [--seconds=1]
+
+    Prints the ns per sample per stream of each path, and the speed-up of
+    the batch over the separate cores.
+
+  ==============================================================================
+*/
+
+#include "FlangerCore.h"
+#include "FlangerBatch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const double kSampleRate = 48000.0;
+
+    const int kStreamCounts[] = { 1, 8, 64, 256 };
+    const int kBlockSizes[] = { 16, 64, 256 };
+
+    // Every stream has its own setting, the four LFO shapes taking turns
+    flanger::Parameters getParameters(int stream, int interpol)
+    {
+        flanger::Parameters params;
+        params.delay = 0.004f + 0.0001f * (float)(stream % 50);
+        params.sweep = 0.005f;
+        params.feedback = 0.7f;
+        params.gain = 1.0f;
+        params.speed = 0.5f + 0.05f * (float)(stream % 40);
+        params.wave = stream % 4;
+        params.interpol = interpol;
+        return params;
+    }
+
+    std::vector<float> makeNoise(size_t numSamples, uint32_t seed)
+    {
+        std::vector<float> data(numSamples);
+        uint32_t state = seed;
+
+        for (auto& sample : data)
+        {
+            state = state * 1664525u + 1013904223u;
+            sample = 0.5f * ((float)(state >> 8) / 8388608.0f - 1.0f);
+        }
+
+        return data;
+    }
+
+    // Runs process() over and over for at least the given time; returns the ns per call
+    template <typename Function>
+    double measureNanosPerCall(double seconds, Function&& process)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        // Warm the caches and the branch predictors first
+        for (int i = 0; i < 16; ++i)
+            process();
+
+        int64_t numCalls = 0;
+        const auto start = Clock::now();
+        std::chrono::duration<double, std::nano> elapsed {};
+
+        do
+        {
+            for (int i = 0; i < 16; ++i)
+                process();
+
+            numCalls += 16;
+            elapsed = Clock::now() - start;
+        }
+        while (elapsed.count() < seconds * 1.0e9);
+
+        return elapsed.count() / (double)numCalls;
+    }
+
+    struct Result
+    {
+        double coresNanos, batchNanos, interleavedNanos;
+    };
+
+    Result run(int numStreams, int blockSize, int interpol, double seconds)
+    {
+        const size_t lanes = (size_t)numStreams;
+        const size_t block = (size_t)blockSize;
+
+        // One mono buffer per stream, processed in place
+        std::vector<std::vector<float>> buffers;
+        std::vector<float*> pointers;
+
+        for (size_t stream = 0; stream < lanes; ++stream)
+            buffers.push_back(makeNoise(block, 12345u + (uint32_t)stream));
+
+        for (auto& buffer : buffers)
+            pointers.push_back(buffer.data());
+
+        std::vector<std::unique_ptr<flanger::FlangerCore>> cores;
+        std::vector<flanger::Parameters> parameters;
+
+        for (int stream = 0; stream < numStreams; ++stream)
+        {
+            cores.push_back(std::unique_ptr<flanger::FlangerCore>(new flanger::FlangerCore()));
+            cores.back()->prepare(kSampleRate, 1, blockSize);
+            parameters.push_back(getParameters(stream, interpol));
+        }
+
+        flanger::FlangerBatch batch;
+        batch.prepare(kSampleRate, numStreams, blockSize, interpol);
+
+        for (int stream = 0; stream < numStreams; ++stream)
+            batch.setParameters(stream, parameters[(size_t)stream]);
+
+        std::vector<float> frames = makeNoise(block * lanes, 54321u);
+
+        // The feedback stays below 1, so the buffers processed in place over and over stay bounded
+        Result result;
+
+        result.coresNanos = measureNanosPerCall(seconds, [&]
+        {
+            for (size_t stream = 0; stream < lanes; ++stream)
+                cores[stream]->process(&pointers[stream], &pointers[stream], 1, blockSize, parameters[stream]);
+        });
+
+        result.batchNanos = measureNanosPerCall(seconds, [&]
+        {
+            batch.process(pointers.data(), pointers.data(), blockSize);
+        });
+
+        result.interleavedNanos = measureNanosPerCall(seconds, [&]
+        {
+            batch.processInterleaved(frames.data(), frames.data(), blockSize);
+        });
+
+        const double samples = (double)block * (double)lanes;
+        result.coresNanos /= samples;
+        result.batchNanos /= samples;
+        result.interleavedNanos /= samples;
+        return result;
+    }
+
+    std::string getOption(int argc, char* argv[], const std::string& option, const std::string& defaultValue)
+    {
+        for (int i = 1; i < argc; ++i)
+            if (std::strncmp(argv[i], (option + "=").c_str(), option.size() + 1) == 0)
+                return argv[i] + option.size() + 1;
+
+        return defaultValue;
+    }
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    const int interpol = std::atoi(getOption(argc, argv, "--interpol", "0").c_str());
+    const double seconds = std::atof(getOption(argc, argv, "--seconds", "1").c_str());
+
+    if (interpol < flanger::kLinear || interpol > flanger::kCubic || ! (seconds > 0.0))
+    {
+        std::cout << "Usage: FlangerBatchBenchmark [--interpol=0|1|2] [--seconds=1]" << std::endl;
+        return 2;
+    }
+
+    std::cout << "Mono streams at " << kSampleRate / 1000.0 << " kHz, interpolator " << interpol
+              << ", ns per sample per stream" << std::endl << std::endl;
+    std::cout << std::setw(8) << "streams" << std::setw(8) << "block"
+              << std::setw(12) << "cores" << std::setw(12) << "batch" << std::setw(14) << "interleaved"
+              << std::setw(10) << "speed-up" << std::endl;
+
+    for (const int numStreams : kStreamCounts)
+    {
+        for (const int blockSize : kBlockSizes)
+        {
+            const auto result = run(numStreams, blockSize, interpol, seconds);
+
+            std::cout << std::setw(8) << numStreams << std::setw(8) << blockSize << std::fixed << std::setprecision(2)
+                      << std::setw(12) << result.coresNanos << std::setw(12) << result.batchNanos
+                      << std::setw(14) << result.interleavedNanos
+                      << std::setw(9) << result.coresNanos / result.interleavedNanos << 'x' << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+/*
+  ==============================================================================
+
+    BenchmarkMain.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Entry point of the headless benchmarks: one sub-command per benchmark.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "ScalingBenchmark.h"
+#include "ProfileReport.h"
+#include "PrepareBenchmark.h"
+#include "StartupBenchmark.h"
+#include "OfflineRenderer.h"
+#include "RealtimeSafetyStress.h"
+#include "../Source/RealtimeSafety.h"
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    // The graph and the parameters need a message manager, even without any window
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand("--help|-h", "Usage: FlangerBenchmarks --<command> [options]", true);
+    app.addCommand(ScalingBenchmark::createCommand());
+    app.addCommand(ProfileReport::createCommand());
+    app.addCommand(PrepareBenchmark::createCommand());
+    app.addCommand(StartupBenchmark::createCommand());
+    app.addCommand(OfflineRenderer::createCommand());
+    app.addCommand(OfflineRenderer::createGenerateCommand());
+
+   #if FLANGER_RT_SAFETY_CHECKS
+    app.addCommand(RealtimeSafetyStress::createCommand());
+   #endif
+
+    return app.findAndRunCommand(argc, argv);
+}
@@ -0,0 +1,77 @@
+/*
+  ==============================================================================
+
+    BenchmarkUtils.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Small helpers shared by the benchmark commands.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#if JUCE_LINUX
+ #include <unistd.h>
+#endif
+
+namespace BenchmarkUtils
+{
+    // Resident set size of the process in bytes, or 0 where it cannot be read
+    inline size_t getResidentBytes()
+    {
+       #if JUCE_LINUX
+        auto fields = juce::StringArray::fromTokens(juce::File("/proc/self/statm").loadFileAsString(), true);
+
+        if (fields.size() > 1)
+            return (size_t)fields[1].getLargeIntValue() * (size_t)sysconf(_SC_PAGESIZE);
+       #endif
+
+        return 0;
+    }
+
+    // Highest resident set size of the process so far in bytes (VmHWM), or 0 where it cannot be read
+    inline size_t getPeakResidentBytes()
+    {
+       #if JUCE_LINUX
+        for (const auto& line : juce::StringArray::fromLines(juce::File("/proc/self/status").loadFileAsString()))
+            if (line.startsWith("VmHWM:"))
+                return (size_t)line.fromFirstOccurrenceOf(":", false, false).trim().getLargeIntValue() * 1024;
+       #endif
+
+        return 0;
+    }
+
+    // Sets a parameter of the processor from its real (not normalised) value
+    inline void setParameter(juce::AudioProcessorValueTreeState& apvts, const juce::String& parameterID, float value)
+    {
+        if (auto* parameter = apvts.getParameter(parameterID))
+            parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    }
+
+    // Fills every channel with white noise at the given peak level
+    inline void fillWithNoise(juce::AudioBuffer<float>& buffer, juce::Random& random, float level = 0.25f)
+    {
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        {
+            auto* data = buffer.getWritePointer(channel);
+
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+                data[i] = level * (2.0f * random.nextFloat() - 1.0f);
+        }
+    }
+
+    // Reads "--name=value" as an int/double, falling back to the default when the option is absent
+    inline int getIntOption(const juce::ArgumentList& args, const juce::String& option, int defaultValue)
+    {
+        return args.containsOption(option) ? args.getValueForOption(option).getIntValue() : defaultValue;
+    }
+
+    inline double getDoubleOption(const juce::ArgumentList& args, const juce::String& option, double defaultValue)
+    {
+        return args.containsOption(option) ? args.getValueForOption(option).getDoubleValue() : defaultValue;
+    }
+}
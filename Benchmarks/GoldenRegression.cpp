@@ -0,0 +1,596 @@
+/*
+  ==============================================================================
+
+    GoldenRegression.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    FlangerGolden: renders fixed test signals (impulse, sweep, noise, tone)
+    through the flanger for every WAVE/INTERPOL/PHASE combination and compares
+    them with the reference renders stored in Benchmarks/Golden, within a
+    numeric tolerance. Each combination must also stay within its ns/sample
+    budget from Golden/budgets.txt.
+
+    It drives FlangerCore, which FlangerAudioProcessor::processBlock forwards
+    to unchanged, so it needs no JUCE and runs on any CI machine.
+
+        FlangerGolden --verify [--dir=...] [--tolerance=1e-4] [--budget-scale=1] [--no-timing] [--compact] [--batch]
+        FlangerGolden --record [--dir=...]
+
+    --verify exits with status 1 on any mismatch or blown budget. Only use
+    --record for an intended change of the sound, and say so in the commit.
+    --compact renders with the 16-bit delay lines (kCompactStorage) against
+    the same float references, to measure what the compact storage costs in
+    accuracy; give it a tolerance of about 1e-3.
+    --batch renders every configuration as a lane of a FlangerBatch, one
+    batch per interpolator, against the same references, without timing.
+
+    --verify also checks that the envelope follower, pushing the delay past
+    the top of the range, holds it where process() limits a plain delay, and
+    that LFO speeds out of range render like the speed process() limits them to.
+
+  ==============================================================================
+*/
+
+#include "FlangerCore.h"
+#include "FlangerBatch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef FLANGER_GOLDEN_DIR
+ #define FLANGER_GOLDEN_DIR "Golden"
+#endif
+
+namespace
+{
+    const double kSampleRate = 48000.0;
+    const int kNumSamples = 4096;
+    const int kBlockSize = 128;
+
+    // Recorded budgets are this many times the time measured on the recording machine
+    const double kBudgetHeadroom = 4.0;
+
+    const char* const signalNames[] = { "impulse", "sweep", "noise", "tone" };
+    const char* const waveNames[] = { "sine", "triangle", "square", "saw" };
+    const char* const interpolNames[] = { "linear", "quadratic", "cubic" };
+    const char* const phaseNames[] = { "normal", "inverted" };
+
+    struct Configuration
+    {
+        int signal, wave, interpol, polarity;
+
+        std::string getName() const
+        {
+            return std::string(signalNames[signal]) + "_" + waveNames[wave] + "_"
+                 + interpolNames[interpol] + "_" + phaseNames[polarity];
+        }
+
+        flanger::Parameters getParameters() const
+        {
+            // A fast, deep, resonant setting, so that a few thousand samples exercise the whole LFO and the feedback path
+            flanger::Parameters params;
+            params.delay = 0.010f;
+            params.sweep = 0.005f;
+            params.feedback = 0.7f;
+            params.gain = 1.0f;
+            params.speed = 8.0f;
+            params.wave = wave;
+            params.interpol = interpol;
+            params.polarity = polarity;
+            return params;
+        }
+    };
+
+    std::vector<Configuration> getAllConfigurations()
+    {
+        std::vector<Configuration> configurations;
+
+        for (int signal = 0; signal < 4; ++signal)
+            for (int wave = 0; wave < 4; ++wave)
+                for (int interpol = 0; interpol < 3; ++interpol)
+                    for (int polarity = 0; polarity < 2; ++polarity)
+                        configurations.push_back({ signal, wave, interpol, polarity });
+
+        return configurations;
+    }
+
+    //==============================================================================
+    // Test signals, generated without any implementation-defined random distribution
+    std::vector<float> makeSignal(int signal)
+    {
+        std::vector<float> data((size_t)kNumSamples, 0.0f);
+        const double twoPi = 6.283185307179586;
+
+        switch (signal)
+        {
+        case 0:     // impulse
+            data[0] = 1.0f;
+            break;
+
+        case 1:     // exponential sine sweep, 20 Hz to 20 kHz
+        {
+            const double duration = kNumSamples / kSampleRate;
+            const double rate = std::log(20000.0 / 20.0);
+
+            for (int i = 0; i < kNumSamples; ++i)
+            {
+                const double t = i / kSampleRate;
+                data[(size_t)i] = (float)(0.5 * std::sin(twoPi * 20.0 * duration / rate * (std::exp(t * rate / duration) - 1.0)));
+            }
+            break;
+        }
+
+        case 2:     // white noise from a 32-bit LCG
+        {
+            uint32_t state = 12345;
+
+            for (auto& sample : data)
+            {
+                state = state * 1664525u + 1013904223u;
+                sample = 0.5f * ((float)(state >> 8) / 8388608.0f - 1.0f);
+            }
+            break;
+        }
+
+        case 3:     // sustained 440 Hz tone
+        default:
+            for (int i = 0; i < kNumSamples; ++i)
+                data[(size_t)i] = (float)(0.5 * std::sin(twoPi * 440.0 * i / kSampleRate));
+            break;
+        }
+
+        return data;
+    }
+
+    // Renders from a cleared delay line in blocks of kBlockSize, as a host would
+    void render(flanger::FlangerCore& flanger, const std::vector<float>& input,
+                std::vector<float>& output, const flanger::Parameters& params)
+    {
+        flanger.reset();
+        output = input;
+
+        for (int start = 0; start < kNumSamples; start += kBlockSize)
+        {
+            float* channel = output.data() + start;
+            flanger.process(&channel, &channel, 1, std::min(kBlockSize, kNumSamples - start), params);
+        }
+    }
+
+    std::vector<float> render(const std::vector<float>& input, const flanger::Parameters& params,
+                              std::unique_ptr<flanger::Wavetable> wavetable = nullptr)
+    {
+        flanger::FlangerCore flanger;
+        flanger.prepare(kSampleRate, 1, kBlockSize);
+
+        if (wavetable != nullptr)
+            flanger.setWavetable(std::move(wavetable));
+
+        std::vector<float> output;
+        render(flanger, input, output, params);
+        return output;
+    }
+
+    // Every configuration of an interpolator as one lane of a batch, rendered in blocks of kBlockSize
+    std::map<std::string, std::vector<float>> renderBatch(int interpol)
+    {
+        std::vector<Configuration> configurations;
+
+        for (const auto& configuration : getAllConfigurations())
+            if (configuration.interpol == interpol)
+                configurations.push_back(configuration);
+
+        const size_t numLanes = configurations.size();
+
+        flanger::FlangerBatch batch;
+        batch.prepare(kSampleRate, (int)numLanes, kBlockSize, interpol);
+
+        std::vector<float> frames((size_t)kNumSamples * numLanes);
+
+        for (size_t lane = 0; lane < numLanes; ++lane)
+        {
+            batch.setParameters((int)lane, configurations[lane].getParameters());
+
+            const auto input = makeSignal(configurations[lane].signal);
+
+            for (size_t i = 0; i < input.size(); ++i)
+                frames[i * numLanes + lane] = input[i];
+        }
+
+        for (int start = 0; start < kNumSamples; start += kBlockSize)
+        {
+            float* block = frames.data() + (size_t)start * numLanes;
+            batch.processInterleaved(block, block, std::min(kBlockSize, kNumSamples - start));
+        }
+
+        std::map<std::string, std::vector<float>> outputs;
+
+        for (size_t lane = 0; lane < numLanes; ++lane)
+        {
+            auto& output = outputs[configurations[lane].getName()];
+            output.resize((size_t)kNumSamples);
+
+            for (size_t i = 0; i < output.size(); ++i)
+                output[i] = frames[i * numLanes + lane];
+        }
+
+        return outputs;
+    }
+
+    // The envelope of a steady noise pushes the delay far past the range: once it has settled, the output must match
+    // a plain delay that process() limits to the top of the range. Returns the relative error.
+    double checkEnvelopeAtRangeTop()
+    {
+        const int numSamples = 16384;
+        std::vector<float> input((size_t)numSamples);
+        uint32_t state = 54321;
+
+        for (auto& sample : input)
+        {
+            state = state * 1664525u + 1013904223u;
+            sample = 0.5f * ((float)(state >> 8) / 8388608.0f - 1.0f);
+        }
+
+        flanger::Parameters limited;
+        limited.delay = 1.0f;
+        limited.sweep = 0.0f;
+        limited.feedback = 0.0f;
+
+        flanger::Parameters pushed = limited;
+        pushed.delay = flanger::FlangerCore::kMaximumDelay;
+        pushed.envelopeToDelay = 0.1f;
+        pushed.envelopeAttack = 0.001f;
+
+        auto renderWith = [&](const flanger::Parameters& params)
+        {
+            flanger::FlangerCore flanger;
+            flanger.prepare(kSampleRate, 1, kBlockSize);
+
+            std::vector<float> output = input;
+
+            for (int start = 0; start < numSamples; start += kBlockSize)
+            {
+                float* channel = output.data() + start;
+                flanger.process(&channel, &channel, 1, std::min(kBlockSize, numSamples - start), params);
+            }
+
+            return output;
+        };
+
+        const auto expected = renderWith(limited);
+        const auto output = renderWith(pushed);
+
+        // The envelope settles within a few ms, then the delay line needs one full length of the settled delay
+        const size_t settled = (size_t)(4 * flanger::FlangerCore::getDelayLineLength(flanger::kFlangeRange, kSampleRate));
+        double error = 0.0;
+
+        for (size_t i = settled; i < output.size(); ++i)
+            error = std::max(error, (double)std::abs(output[i] - expected[i]));
+
+        return error;
+    }
+
+    // A speed the LFO cannot follow (negative, or past half the sample rate) must render like the limit process()
+    // clamps it to, for every shape, instead of stepping the phase out of the tables. Returns the worst error.
+    double checkSpeedOutOfRange()
+    {
+        // A ramp up and a ramp down, so the user table differs at both of its ends
+        const float points[] = { 0.0f, 1.0f, 0.25f };
+        const auto table = flanger::Wavetable::fromPoints(points, 3);
+
+        // Phases outside 0-1 wrap into it, including the ones that round to exactly one period
+        if (table->getValue(1.0f) != table->getValue(0.0f) || table->getValue(-0.25f) != table->getValue(0.75f)
+            || ! (std::abs(table->getValue(-1.0e-9f) - table->getValue(0.0f)) <= 1.0e-6f))
+            return HUGE_VAL;
+
+        const auto input = makeSignal(2);
+        const float nyquist = (float)(0.5 * kSampleRate);
+        const float speeds[][2] = { { -1.0f, 0.0f }, { -1.0e9f, 0.0f }, { (float)kSampleRate, nyquist }, { 1.0e9f, nyquist } };
+        double worstError = 0.0;
+
+        for (int shape = 0; shape <= flanger::kWavetableWave + 1; ++shape)
+        {
+            for (const auto& speed : speeds)
+            {
+                flanger::Parameters params = Configuration { 2, 0, 0, 0 }.getParameters();
+
+                // One past the LFO shapes: the barberpole taps, which ramp at the same speed
+                if (shape > flanger::kWavetableWave)
+                    params.barberpole = flanger::kBarberpoleRising;
+                else
+                    params.wave = shape;
+
+                params.speed = speed[1];
+                const auto expected = render(input, params, flanger::Wavetable::fromPoints(points, 3));
+
+                params.speed = speed[0];
+                const auto output = render(input, params, flanger::Wavetable::fromPoints(points, 3));
+
+                for (size_t i = 0; i < output.size(); ++i)
+                {
+                    if (! std::isfinite(output[i]))
+                        return HUGE_VAL;
+
+                    worstError = std::max(worstError, (double)std::abs(output[i] - expected[i]));
+                }
+            }
+        }
+
+        // The batch lanes of its four periodic shapes: each speed out of range next to the limit it clamps to
+        const int numLanes = 4 * 2 * (int)(sizeof(speeds) / sizeof(speeds[0]));
+        flanger::FlangerBatch batch;
+        batch.prepare(kSampleRate, numLanes, kBlockSize, flanger::kLinear);
+
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            flanger::Parameters params = Configuration { 2, lane / 8, 0, 0 }.getParameters();
+            params.speed = speeds[(lane / 2) % 4][lane % 2];
+            batch.setParameters(lane, params);
+        }
+
+        std::vector<float> frames((size_t)kNumSamples * (size_t)numLanes);
+
+        for (size_t i = 0; i < frames.size(); ++i)
+            frames[i] = input[i / (size_t)numLanes];
+
+        for (int start = 0; start < kNumSamples; start += kBlockSize)
+        {
+            float* block = frames.data() + (size_t)start * (size_t)numLanes;
+            batch.processInterleaved(block, block, std::min(kBlockSize, kNumSamples - start));
+        }
+
+        for (size_t i = 0; i < frames.size(); i += 2)
+        {
+            if (! std::isfinite(frames[i]))
+                return HUGE_VAL;
+
+            worstError = std::max(worstError, (double)std::abs(frames[i] - frames[i + 1]));
+        }
+
+        return worstError;
+    }
+
+    // Best of several runs, which filters out most of the scheduling noise
+    double measureNanosPerSample(const std::vector<float>& input, const flanger::Parameters& params)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        flanger::FlangerCore flanger;
+        flanger.prepare(kSampleRate, 1, kBlockSize);
+
+        std::vector<float> output;
+        output.reserve(input.size());
+        double best = 1.0e30;
+
+        for (int run = 0; run < 7; ++run)
+        {
+            const auto start = Clock::now();
+
+            for (int pass = 0; pass < 10; ++pass)
+                render(flanger, input, output, params);
+
+            const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+            best = std::min(best, elapsed.count() / (10.0 * kNumSamples));
+        }
+
+        return best;
+    }
+
+    //==============================================================================
+    bool readFloats(const std::string& path, std::vector<float>& data)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        if (! file)
+            return false;
+
+        data.assign((size_t)kNumSamples, 0.0f);
+        file.read(reinterpret_cast<char*>(data.data()), (std::streamsize)(data.size() * sizeof(float)));
+        return file.gcount() == (std::streamsize)(data.size() * sizeof(float));
+    }
+
+    bool writeFloats(const std::string& path, const std::vector<float>& data)
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)(data.size() * sizeof(float)));
+        return (bool)file;
+    }
+
+    std::map<std::string, double> readBudgets(const std::string& path)
+    {
+        std::map<std::string, double> budgets;
+        std::ifstream file(path);
+        std::string line;
+
+        while (std::getline(file, line))
+        {
+            std::istringstream fields(line);
+            std::string name;
+            double nanos;
+
+            if (line.empty() || line[0] == '#' || ! (fields >> name >> nanos))
+                continue;
+
+            budgets[name] = nanos;
+        }
+
+        return budgets;
+    }
+
+    std::string getOption(int argc, char* argv[], const std::string& option, const std::string& defaultValue)
+    {
+        for (int i = 1; i < argc; ++i)
+            if (std::strncmp(argv[i], (option + "=").c_str(), option.size() + 1) == 0)
+                return argv[i] + option.size() + 1;
+
+        return defaultValue;
+    }
+
+    bool hasOption(int argc, char* argv[], const std::string& option)
+    {
+        for (int i = 1; i < argc; ++i)
+            if (option == argv[i])
+                return true;
+
+        return false;
+    }
+
+    //==============================================================================
+    int record(const std::string& directory)
+    {
+        std::ofstream budgets(directory + "/budgets.txt");
+        budgets << "# configuration  ns/sample budget (" << kBudgetHeadroom << "x the time measured when recording)\n";
+
+        for (const auto& configuration : getAllConfigurations())
+        {
+            const auto input = makeSignal(configuration.signal);
+            const auto params = configuration.getParameters();
+
+            if (! writeFloats(directory + "/" + configuration.getName() + ".f32", render(input, params)))
+            {
+                std::cerr << "Cannot write " << configuration.getName() << " to " << directory << std::endl;
+                return 1;
+            }
+
+            const auto budget = kBudgetHeadroom * measureNanosPerSample(input, params);
+            budgets << configuration.getName() << ' ' << std::ceil(budget * 10.0) / 10.0 << '\n';
+        }
+
+        std::cout << "Recorded " << getAllConfigurations().size() << " references in " << directory << std::endl;
+        return 0;
+    }
+
+    int verify(const std::string& directory, double tolerance, double budgetScale, bool checkTiming, int delayStorage, bool batch)
+    {
+        const auto budgets = readBudgets(directory + "/budgets.txt");
+        int numFailures = 0;
+        double worstError = 0.0;
+
+        std::map<std::string, std::vector<float>> batchOutputs;
+
+        if (batch)
+        {
+            for (int interpol = 0; interpol < 3; ++interpol)
+            {
+                const auto outputs = renderBatch(interpol);
+                batchOutputs.insert(outputs.begin(), outputs.end());
+            }
+
+            // The budgets are for FlangerCore alone
+            checkTiming = false;
+        }
+
+        for (const auto& configuration : getAllConfigurations())
+        {
+            const auto name = configuration.getName();
+            const auto input = makeSignal(configuration.signal);
+            auto params = configuration.getParameters();
+            params.delayStorage = delayStorage;
+
+            std::vector<float> reference;
+
+            if (! readFloats(directory + "/" + name + ".f32", reference))
+            {
+                std::cout << "FAIL  " << name << ": missing reference" << std::endl;
+                ++numFailures;
+                continue;
+            }
+
+            // The tolerance is relative to the peak of the reference, so that resonant settings aren't held to a tighter bound
+            const auto output = batch ? batchOutputs[name] : render(input, params);
+            float peak = 1.0f;
+            double error = 0.0;
+
+            for (size_t i = 0; i < reference.size(); ++i)
+            {
+                peak = std::max(peak, std::abs(reference[i]));
+                error = std::max(error, (double)std::abs(output[i] - reference[i]));
+            }
+
+            error /= peak;
+            worstError = std::max(worstError, error);
+
+            if (! (error <= tolerance))
+            {
+                std::cout << "FAIL  " << name << ": relative error " << error << " > " << tolerance << std::endl;
+                ++numFailures;
+            }
+
+            if (checkTiming)
+            {
+                const auto budget = budgets.find(name);
+
+                if (budget == budgets.end())
+                {
+                    std::cout << "FAIL  " << name << ": no ns/sample budget" << std::endl;
+                    ++numFailures;
+                    continue;
+                }
+
+                const auto nanos = measureNanosPerSample(input, params);
+
+                if (nanos > budget->second * budgetScale)
+                {
+                    std::cout << "FAIL  " << name << ": " << nanos << " ns/sample > budget "
+                              << budget->second * budgetScale << std::endl;
+                    ++numFailures;
+                }
+            }
+        }
+
+        // Peaks of about 1, so the absolute error is relative
+        const double envelopeError = checkEnvelopeAtRangeTop();
+
+        if (! (envelopeError <= tolerance))
+        {
+            std::cout << "FAIL  envelope at the top of the range: relative error " << envelopeError << " > " << tolerance << std::endl;
+            ++numFailures;
+        }
+
+        const double speedError = checkSpeedOutOfRange();
+
+        if (! (speedError <= tolerance))
+        {
+            std::cout << "FAIL  LFO speed out of range: relative error " << speedError << " > " << tolerance << std::endl;
+            ++numFailures;
+        }
+
+        std::cout << getAllConfigurations().size() << " configurations, worst relative error " << worstError
+                  << ", " << numFailures << " failures" << std::endl;
+
+        return numFailures == 0 ? 0 : 1;
+    }
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    const auto directory = getOption(argc, argv, "--dir", FLANGER_GOLDEN_DIR);
+
+    if (hasOption(argc, argv, "--record"))
+        return record(directory);
+
+    if (hasOption(argc, argv, "--verify"))
+        return verify(directory,
+                      std::atof(getOption(argc, argv, "--tolerance", "1e-4").c_str()),
+                      std::atof(getOption(argc, argv, "--budget-scale", "1").c_str()),
+                      ! hasOption(argc, argv, "--no-timing"),
+                      hasOption(argc, argv, "--compact") ? flanger::kCompactStorage : flanger::kFloatStorage,
+                      hasOption(argc, argv, "--batch"));
+
+    std::cout << "Usage: FlangerGolden --verify [--dir=path] [--tolerance=1e-4] [--budget-scale=1] [--no-timing] [--compact] [--batch]" << std::endl
+              << "       FlangerGolden --record [--dir=path]" << std::endl;
+    return 2;
+}
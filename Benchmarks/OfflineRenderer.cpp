@@ -0,0 +1,358 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "OfflineRenderer.h"
+#include "BenchmarkUtils.h"
+#include "../FlangerCore/FlangerCore.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    const int kGenerateChunkSize = 65536;
+
+    double secondsSince(juce::int64 startTicks)
+    {
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+    }
+
+    //==============================================================================
+    // How far each stage of the pipeline got, in chunks. Chunk n stays in slot n % numSlots from the
+    // read to the write, so the reader waits for the writer to free a slot, the DSP for the reader,
+    // and the writer for the DSP. A stage that fails wakes the others up, and they stop.
+    class Stages
+    {
+    public:
+        // Waits until ready() holds, under the lock; false if a stage failed meanwhile
+        template <typename Predicate>
+        bool waitFor(Predicate&& ready)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [&] { return failed || ready(); });
+            return ! failed;
+        }
+
+        void finished(juce::int64& counter)
+        {
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                ++counter;
+            }
+
+            condition.notify_all();
+        }
+
+        void fail(const juce::String& message)
+        {
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+
+                if (! failed)
+                    error = message;
+
+                failed = true;
+            }
+
+            condition.notify_all();
+        }
+
+        juce::int64 numRead = 0, numProcessed = 0, numWritten = 0;
+        bool failed = false;
+        juce::String error;
+
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    //==============================================================================
+    // The default of every parameter, or the value given as "--ID=value" (choices by index)
+    FlangerParameters::Snapshot getValues(const juce::ArgumentList& args)
+    {
+        auto values = FlangerParameters::getDefaults();
+
+        for (const auto& info : FlangerParameters::kTable)
+        {
+            const auto option = "--" + juce::String(info.id);
+
+            if (args.containsOption(option))
+                values.values[(size_t)info.index] = FlangerParameters::constrain(info, args.getValueForOption(option).getFloatValue());
+        }
+
+        return values;
+    }
+
+    // A writer streaming to a new file in the format of its extension, or a failed command
+    std::unique_ptr<juce::AudioFormatWriter> createWriter(juce::AudioFormatManager& formats, const juce::File& file, double sampleRate,
+                                                          int numChannels, int bitsPerSample, const juce::StringPairArray& metadata)
+    {
+        auto* format = formats.findFormatForFileExtension(file.getFileExtension());
+
+        if (format == nullptr)
+            juce::ConsoleApplication::fail("Unknown audio file format: " + file.getFullPathName());
+
+        file.deleteFile();
+        auto stream = file.createOutputStream();
+
+        if (stream == nullptr || stream->failedToOpen())
+            juce::ConsoleApplication::fail("Cannot write " + file.getFullPathName());
+
+        std::unique_ptr<juce::AudioFormatWriter> writer(format->createWriterFor(stream.get(), sampleRate, (unsigned int)numChannels,
+                                                                                bitsPerSample, metadata, 0));
+
+        if (writer == nullptr)
+            juce::ConsoleApplication::fail(format->getFormatName() + " cannot store " + juce::String(numChannels) + " channels of "
+                                           + juce::String(bitsPerSample) + "-bit samples at " + juce::String(sampleRate) + " Hz");
+
+        // The writer owns the stream from now on
+        stream.release();
+        return writer;
+    }
+
+    juce::String describeBytes(size_t bytes)
+    {
+        return juce::File::descriptionOfSizeInBytes((juce::int64)bytes);
+    }
+}
+
+//==============================================================================
+OfflineRenderer::Result OfflineRenderer::render(const Options& options)
+{
+    Result result;
+    result.startResidentBytes = BenchmarkUtils::getResidentBytes();
+
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    auto* inputFormat = formats.findFormatForFileExtension(options.input.getFileExtension());
+
+    if (inputFormat == nullptr)
+        juce::ConsoleApplication::fail("Unknown audio file format: " + options.input.getFullPathName());
+
+    // Only the uncompressed formats (WAV, AIFF) can be read straight from the mapped file
+    std::unique_ptr<juce::MemoryMappedAudioFormatReader> reader(inputFormat->createMemoryMappedReader(options.input));
+
+    if (reader == nullptr || reader->numChannels == 0)
+        juce::ConsoleApplication::fail("Cannot map " + options.input.getFullPathName() + " (only WAV and AIFF files can be mapped)");
+
+    result.numFrames = reader->lengthInSamples;
+    result.numChannels = (int)reader->numChannels;
+    result.sampleRate = reader->sampleRate;
+
+    const int bitsPerSample = options.bitsPerSample > 0 ? options.bitsPerSample : (int)reader->bitsPerSample;
+    auto writer = createWriter(formats, options.output, result.sampleRate, result.numChannels, bitsPerSample, reader->metadataValues);
+
+    // The only memory that grows with the settings: numChunks buffers of chunkSize samples per channel
+    const int chunkSize = juce::jmax(1, options.chunkSize);
+    const int blockSize = juce::jlimit(1, chunkSize, options.blockSize);
+    const int numSlots = juce::jmax(2, options.numChunks);
+    const juce::int64 numChunks = (result.numFrames + chunkSize - 1) / chunkSize;
+
+    std::vector<juce::AudioBuffer<float>> chunks((size_t)numSlots, juce::AudioBuffer<float>(result.numChannels, chunkSize));
+
+    auto getChunk = [&](juce::int64 n) -> juce::AudioBuffer<float>& { return chunks[(size_t)(n % numSlots)]; };
+    auto getChunkLength = [&](juce::int64 n) { return (int)juce::jmin((juce::int64)chunkSize, result.numFrames - n * chunkSize); };
+
+    flanger::FlangerCore core;
+    core.prepare(result.sampleRate, result.numChannels, blockSize);
+    const auto params = FlangerParameters::toCoreParameters(options.values);
+
+    std::vector<float*> channels((size_t)result.numChannels);
+    Stages stages;
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    std::thread readerThread([&]
+    {
+        for (juce::int64 n = 0; n < numChunks; ++n)
+        {
+            if (! stages.waitFor([&] { return n - stages.numWritten < numSlots; }))
+                return;
+
+            const auto ticks = juce::Time::getHighResolutionTicks();
+            const auto first = n * chunkSize;
+            const int numSamples = getChunkLength(n);
+
+            // Maps this chunk alone, which unmaps the previous one: the resident set holds one chunk of the
+            // file at a time, whatever its length. The page faults of the conversion are the disk reads.
+            if (! reader->mapSectionOfFile({ first, first + numSamples }))
+            {
+                stages.fail("Cannot map samples " + juce::String(first) + " to " + juce::String(first + numSamples)
+                            + " of " + options.input.getFullPathName());
+                return;
+            }
+
+            reader->read(&getChunk(n), 0, numSamples, first, true, true);
+            result.readSeconds += secondsSince(ticks);
+            stages.finished(stages.numRead);
+        }
+    });
+
+    std::thread writerThread([&]
+    {
+        for (juce::int64 n = 0; n < numChunks; ++n)
+        {
+            if (! stages.waitFor([&] { return stages.numProcessed > n; }))
+                return;
+
+            const auto ticks = juce::Time::getHighResolutionTicks();
+
+            if (! writer->writeFromAudioSampleBuffer(getChunk(n), 0, getChunkLength(n)))
+            {
+                stages.fail("Cannot write " + options.output.getFullPathName());
+                return;
+            }
+
+            result.writeSeconds += secondsSince(ticks);
+            stages.finished(stages.numWritten);
+        }
+    });
+
+    // The DSP runs on this thread, block by block through each chunk, as a host would call it
+    {
+        juce::ScopedNoDenormals noDenormals;
+
+        for (juce::int64 n = 0; n < numChunks; ++n)
+        {
+            if (! stages.waitFor([&] { return stages.numRead > n; }))
+                break;
+
+            const auto ticks = juce::Time::getHighResolutionTicks();
+            auto& chunk = getChunk(n);
+            const int numSamples = getChunkLength(n);
+
+            for (int offset = 0; offset < numSamples; offset += blockSize)
+            {
+                for (int channel = 0; channel < result.numChannels; ++channel)
+                    channels[(size_t)channel] = chunk.getWritePointer(channel, offset);
+
+                core.process(channels.data(), channels.data(), result.numChannels, juce::jmin(blockSize, numSamples - offset), params);
+            }
+
+            result.dspSeconds += secondsSince(ticks);
+            stages.finished(stages.numProcessed);
+        }
+    }
+
+    readerThread.join();
+    writerThread.join();
+
+    // Closing the writer updates the header with the final length
+    writer.reset();
+    result.seconds = secondsSince(startTicks);
+    result.peakResidentBytes = BenchmarkUtils::getPeakResidentBytes();
+
+    if (stages.failed)
+        juce::ConsoleApplication::fail(stages.error);
+
+    return result;
+}
+
+void OfflineRenderer::generate(const juce::File& file, double hours, int numChannels, double sampleRate, int bitsPerSample)
+{
+    juce::AudioFormatManager formats;
+    formats.registerBasicFormats();
+
+    auto writer = createWriter(formats, file, sampleRate, numChannels, bitsPerSample, {});
+
+    const auto numFrames = (juce::int64)(hours * 3600.0 * sampleRate);
+    juce::AudioBuffer<float> chunk(numChannels, kGenerateChunkSize);
+    std::vector<float> phases((size_t)numChannels, 0.0f);
+    juce::Random random(1);
+
+    // Every channel has its own tone under some noise, so that they can be told apart in the render
+    for (juce::int64 first = 0; first < numFrames; first += kGenerateChunkSize)
+    {
+        const int numSamples = (int)juce::jmin((juce::int64)kGenerateChunkSize, numFrames - first);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            auto* data = chunk.getWritePointer(channel);
+            auto& phase = phases[(size_t)channel];
+            const float increment = juce::MathConstants<float>::twoPi * 110.0f * (float)(channel + 1) / (float)sampleRate;
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                data[i] = 0.25f * std::sin(phase) + 0.05f * (2.0f * random.nextFloat() - 1.0f);
+                phase += increment;
+
+                if (phase >= juce::MathConstants<float>::twoPi)
+                    phase -= juce::MathConstants<float>::twoPi;
+            }
+        }
+
+        if (! writer->writeFromAudioSampleBuffer(chunk, 0, numSamples))
+            juce::ConsoleApplication::fail("Cannot write " + file.getFullPathName());
+    }
+
+    writer.reset();
+
+    std::cout << "Wrote " << file.getFullPathName() << ": " << numChannels << " channels, " << sampleRate << " Hz, "
+              << bitsPerSample << "-bit, " << numFrames << " frames, " << file.getSize() << " bytes" << std::endl;
+}
+
+//==============================================================================
+juce::ConsoleApplication::Command OfflineRenderer::createCommand()
+{
+    return { "--render",
+             "--render --input=in.wav --output=out.wav [--chunk=65536] [--block=512] [--chunks=4] [--bits=24] [--ID=value...]",
+             "Renders a WAV or AIFF file of any length through the flanger with constant memory, and prints the throughput",
+             "Parameters are given by ID, choices by index (--DELAY=12 --FB=0.8 --WAVE=1); the others keep their defaults. "
+             "Every channel of the input is processed, with one LFO.",
+             [](const juce::ArgumentList& args)
+             {
+                 Options options;
+                 options.input = args.getExistingFileForOption("--input");
+                 options.output = args.getFileForOption("--output");
+                 options.chunkSize = BenchmarkUtils::getIntOption(args, "--chunk", options.chunkSize);
+                 options.blockSize = BenchmarkUtils::getIntOption(args, "--block", options.blockSize);
+                 options.numChunks = BenchmarkUtils::getIntOption(args, "--chunks", options.numChunks);
+                 options.bitsPerSample = BenchmarkUtils::getIntOption(args, "--bits", options.bitsPerSample);
+                 options.values = getValues(args);
+
+                 const auto result = render(options);
+
+                 const double duration = (double)result.numFrames / result.sampleRate;
+                 const double seconds = juce::jmax(result.seconds, 1.0e-9);
+                 const auto inputBytes = (double)options.input.getSize();
+
+                 std::cout << "Rendered " << options.input.getFullPathName() << " to " << options.output.getFullPathName() << std::endl
+                           << result.numChannels << " channels, " << result.sampleRate << " Hz, " << juce::String(duration / 3600.0, 3)
+                           << " h (" << result.numFrames << " frames), chunks of " << options.chunkSize << " in blocks of "
+                           << options.blockSize << std::endl << std::endl
+                           << "Wall time:      " << juce::String(result.seconds, 2) << " s, " << juce::String(duration / seconds, 1)
+                           << "x realtime, " << juce::String(inputBytes / seconds / 1.0e6, 1) << " MB/s read" << std::endl
+                           << "DSP:            " << juce::String(result.dspSeconds, 2) << " s ("
+                           << juce::String(100.0 * result.dspSeconds / seconds, 1) << " % of the wall time)" << std::endl
+                           << "Reader thread:  " << juce::String(result.readSeconds, 2) << " s" << std::endl
+                           << "Writer thread:  " << juce::String(result.writeSeconds, 2) << " s" << std::endl
+                           << "Peak resident:  " << describeBytes(result.peakResidentBytes) << " ("
+                           << describeBytes(result.startResidentBytes) << " before the render)" << std::endl;
+             } };
+}
+
+juce::ConsoleApplication::Command OfflineRenderer::createGenerateCommand()
+{
+    return { "--make-input",
+             "--make-input --output=long.wav [--hours=4] [--channels=8] [--rate=48000] [--bits=24]",
+             "Writes a long multichannel test input for --render",
+             "A 110 Hz tone per channel number (110, 220, 330 Hz...) under white noise. Four hours of 8 channels of "
+             "24-bit audio at 48 kHz take about 16.6 GB; WAV files over 4 GB are written as RF64.",
+             [](const juce::ArgumentList& args)
+             {
+                 generate(args.getFileForOption("--output"),
+                          BenchmarkUtils::getDoubleOption(args, "--hours", 4.0),
+                          juce::jmax(1, BenchmarkUtils::getIntOption(args, "--channels", 8)),
+                          BenchmarkUtils::getDoubleOption(args, "--rate", 48000.0),
+                          BenchmarkUtils::getIntOption(args, "--bits", 24));
+             } };
+}
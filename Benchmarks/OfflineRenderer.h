@@ -0,0 +1,57 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Renders an audio file of any length and channel count through FlangerCore
+    with constant memory. A reader thread maps one chunk of the input at a
+    time and converts it from the mapped pages, the calling thread processes
+    it, and a writer thread streams it to the output, so the disk and the DSP
+    work at the same time. Prints the throughput and the peak resident memory.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Source/FlangerParameters.h"
+
+//==============================================================================
+class OfflineRenderer
+{
+public:
+    struct Options
+    {
+        juce::File input, output;
+        int chunkSize = 65536;      // samples per channel read, processed and written at a time
+        int blockSize = 512;        // samples per channel of each FlangerCore::process() call
+        int numChunks = 4;          // chunks in flight: one reading, one processing, the rest writing
+        int bitsPerSample = 0;      // of the output, 0 for the input's
+        FlangerParameters::Snapshot values = FlangerParameters::getDefaults();
+    };
+
+    struct Result
+    {
+        juce::int64 numFrames = 0;
+        int numChannels = 0;
+        double sampleRate = 0.0;
+        double seconds = 0.0;       // wall time, from the first read to the last write
+        double dspSeconds = 0.0;    // spent in FlangerCore::process()
+        double readSeconds = 0.0;   // spent by the reader thread mapping and converting
+        double writeSeconds = 0.0;  // spent by the writer thread converting and writing
+        size_t startResidentBytes = 0;
+        size_t peakResidentBytes = 0;
+    };
+
+    // Fails the command (juce::ConsoleApplication::fail) when a file cannot be read or written
+    static Result render(const Options& options);
+
+    // Writes a test input of noise and tones of the given length, streamed in chunks like render()
+    static void generate(const juce::File& file, double hours, int numChannels, double sampleRate, int bitsPerSample);
+
+    static juce::ConsoleApplication::Command createCommand();
+    static juce::ConsoleApplication::Command createGenerateCommand();
+};
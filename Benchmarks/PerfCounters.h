@@ -0,0 +1,111 @@
+/*
+  ==============================================================================
+
+    PerfCounters.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Hardware cache counters of the calling thread, read through perf_event_open
+    on Linux. Elsewhere, or when the kernel refuses access (see
+    /proc/sys/kernel/perf_event_paranoid), isAvailable() returns false and the
+    benchmarks report the counters as n/a.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#if JUCE_LINUX
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#endif
+
+//==============================================================================
+class PerfCounters
+{
+public:
+    PerfCounters()
+    {
+       #if JUCE_LINUX
+        cacheReferences = openCounter(PERF_COUNT_HW_CACHE_REFERENCES, -1);
+
+        if (cacheReferences >= 0)
+            cacheMisses = openCounter(PERF_COUNT_HW_CACHE_MISSES, cacheReferences);
+       #endif
+    }
+
+    ~PerfCounters()
+    {
+       #if JUCE_LINUX
+        if (cacheMisses >= 0)
+            ::close(cacheMisses);
+
+        if (cacheReferences >= 0)
+            ::close(cacheReferences);
+       #endif
+    }
+
+    bool isAvailable() const noexcept { return cacheReferences >= 0 && cacheMisses >= 0; }
+
+    // Resets and starts both counters together
+    void start() noexcept
+    {
+       #if JUCE_LINUX
+        if (isAvailable())
+        {
+            ioctl(cacheReferences, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(cacheReferences, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+       #endif
+    }
+
+    void stop() noexcept
+    {
+       #if JUCE_LINUX
+        if (isAvailable())
+            ioctl(cacheReferences, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+       #endif
+    }
+
+    juce::uint64 getCacheReferences() const noexcept { return readCounter(cacheReferences); }
+    juce::uint64 getCacheMisses() const noexcept { return readCounter(cacheMisses); }
+
+private:
+   #if JUCE_LINUX
+    static int openCounter(juce::uint64 config, int groupLeader) noexcept
+    {
+        perf_event_attr attr {};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = groupLeader < 0 ? 1 : 0;   // the group leader starts every counter of the group
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        return (int)syscall(__NR_perf_event_open, &attr, 0, -1, groupLeader, 0);
+    }
+   #endif
+
+    static juce::uint64 readCounter(int fd) noexcept
+    {
+        juce::uint64 value = 0;
+
+       #if JUCE_LINUX
+        if (fd >= 0 && ::read(fd, &value, sizeof(value)) != (ssize_t)sizeof(value))
+            value = 0;
+       #else
+        juce::ignoreUnused(fd);
+       #endif
+
+        return value;
+    }
+
+    int cacheReferences = -1;
+    int cacheMisses = -1;
+
+    JUCE_DECLARE_NON_COPYABLE(PerfCounters)
+};
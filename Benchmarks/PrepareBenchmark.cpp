@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+    PrepareBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "PrepareBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "../Source/PluginProcessor.h"
+#include "../Source/RealtimeSafety.h"
+
+namespace
+{
+    // The configurations cycled through, as a host switching projects and bouncing would
+    const double kSampleRates[] = { 44100.0, 48000.0, 88200.0, 96000.0, 192000.0 };
+    const int kBlockSizes[] = { 32, 64, 128, 256, 512, 1024, 2048 };
+
+    struct Timing
+    {
+        double totalMs = 0.0;
+        double worstMs = 0.0;
+        int numRounds = 0;
+
+        void add(double ms)
+        {
+            totalMs += ms;
+            worstMs = juce::jmax(worstMs, ms);
+            ++numRounds;
+        }
+
+        void print(const juce::String& name, int numInstances) const
+        {
+            const double meanMs = numRounds > 0 ? totalMs / numRounds : 0.0;
+
+            std::cout << name.paddedRight(' ', 15)
+                      << juce::String(meanMs, 3).paddedLeft(' ', 12)
+                      << juce::String(worstMs, 3).paddedLeft(' ', 12)
+                      << juce::String(1000.0 * meanMs / numInstances, 2).paddedLeft(' ', 12) << std::endl;
+        }
+    };
+
+    template <typename Function>
+    double timeMilliseconds(Function&& function)
+    {
+        const auto start = juce::Time::getHighResolutionTicks();
+        function();
+        return 1000.0 * juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+    }
+}
+
+//==============================================================================
+juce::ConsoleApplication::Command PrepareBenchmark::createCommand()
+{
+    return { "--reprepare",
+             "--reprepare [--instances=500] [--rounds=35]",
+             "Times prepareToPlay() and reset() on many instances as the sample rate and block size change",
+             "Every instance is prepared once at 192 kHz and 2048 samples, then each round re-prepares all of them at the next "
+             "rate (44.1 to 192 kHz) and block size (32 to 2048 samples) of a cycle, then resets them. "
+             "Built with -DFLANGER_RT_SAFETY_CHECKS=1, it also reports every allocation made after the first prepare.",
+             [](const juce::ArgumentList& args)
+             {
+                 const int numInstances = BenchmarkUtils::getIntOption(args, "--instances", 500);
+                 const int numRounds = BenchmarkUtils::getIntOption(args, "--rounds", 35);
+
+                 if (numInstances < 1 || numRounds < 1)
+                     juce::ConsoleApplication::fail("Invalid reprepare options, see --help");
+
+                 std::vector<std::unique_ptr<FlangerAudioProcessor>> processors;
+
+                 for (int i = 0; i < numInstances; ++i)
+                 {
+                     processors.push_back(std::make_unique<FlangerAudioProcessor>());
+                     processors.back()->setRateAndBufferSizeDetails(192000.0, 2048);
+                     processors.back()->prepareToPlay(192000.0, 2048);
+                 }
+
+                #if FLANGER_RT_SAFETY_CHECKS
+                 RealtimeSafety::resetViolations();
+                #endif
+
+                 Timing prepareTiming, resetTiming;
+
+                 for (int round = 0; round < numRounds; ++round)
+                 {
+                     const double sampleRate = kSampleRates[round % juce::numElementsInArray(kSampleRates)];
+                     const int blockSize = kBlockSizes[round % juce::numElementsInArray(kBlockSizes)];
+
+                     // Nothing below may allocate: the checks report it as if it ran on the audio thread
+                     const RealtimeSafety::ScopedAudioThread allocationCheck;
+
+                     prepareTiming.add(timeMilliseconds([&]
+                     {
+                         for (auto& processor : processors)
+                         {
+                             processor->setRateAndBufferSizeDetails(sampleRate, blockSize);
+                             processor->prepareToPlay(sampleRate, blockSize);
+                         }
+                     }));
+
+                     resetTiming.add(timeMilliseconds([&]
+                     {
+                         for (auto& processor : processors)
+                             processor->reset();
+                     }));
+                 }
+
+                 std::cout << "Flanger re-prepare: " << numInstances << " instances, " << numRounds << " rounds" << std::endl << std::endl;
+                 std::cout << juce::String("call").paddedRight(' ', 15)
+                           << juce::String("mean ms").paddedLeft(' ', 12)
+                           << juce::String("worst ms").paddedLeft(' ', 12)
+                           << juce::String("us/inst").paddedLeft(' ', 12) << std::endl;
+
+                 prepareTiming.print("prepareToPlay", numInstances);
+                 resetTiming.print("reset", numInstances);
+
+                #if FLANGER_RT_SAFETY_CHECKS
+                 std::cout << std::endl << "Allocations after the first prepare: " << RealtimeSafety::getNumViolations() << std::endl;
+                #endif
+             } };
+}
@@ -0,0 +1,24 @@
+/*
+  ==============================================================================
+
+    PrepareBenchmark.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Times prepareToPlay() and reset() across many instances, the way a host
+    reconfigures a project: every instance is prepared once for the largest
+    rate and block size, then re-prepared round after round at other ones.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+class PrepareBenchmark
+{
+public:
+    static juce::ConsoleApplication::Command createCommand();
+};
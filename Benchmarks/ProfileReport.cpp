@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    ProfileReport.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "ProfileReport.h"
+#include "BenchmarkUtils.h"
+#include "../Source/PluginProcessor.h"
+
+//==============================================================================
+juce::ConsoleApplication::Command ProfileReport::createCommand()
+{
+    return { "--profile",
+             "--profile [--sample-rate=48000] [--block=128] [--seconds=10] [--wave=0] [--interpol=0] [--adaptive]",
+             "Prints the block profiler report of one instance after rendering noise through it",
+             "Build with -DFLANGER_TRACE_STAGES=1 to also get the cycles spent in the LFO, interpolation and feedback stages.",
+             [](const juce::ArgumentList& args)
+             {
+                 const auto sampleRate = BenchmarkUtils::getDoubleOption(args, "--sample-rate", 48000.0);
+                 const auto blockSize = BenchmarkUtils::getIntOption(args, "--block", 128);
+                 const auto seconds = BenchmarkUtils::getDoubleOption(args, "--seconds", 10.0);
+
+                 if (sampleRate <= 0.0 || blockSize <= 0 || seconds <= 0.0)
+                     juce::ConsoleApplication::fail("Invalid profile options, see --help");
+
+                 FlangerAudioProcessor processor;
+                 BenchmarkUtils::setParameter(processor.apvts, "WAVE", (float)BenchmarkUtils::getIntOption(args, "--wave", 0));
+                 BenchmarkUtils::setParameter(processor.apvts, "INTERPOL", (float)BenchmarkUtils::getIntOption(args, "--interpol", 0));
+                 BenchmarkUtils::setParameter(processor.apvts, "ADAPTIVE", args.containsOption("--adaptive") ? 1.0f : 0.0f);
+
+                 processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+                 processor.prepareToPlay(sampleRate, blockSize);
+
+                 juce::AudioBuffer<float> buffer(2, blockSize);
+                 juce::MidiBuffer midi;
+                 juce::Random random(1);
+
+                 const auto numBlocks = (juce::int64)(seconds * sampleRate / blockSize);
+
+                 for (juce::int64 block = 0; block < numBlocks; ++block)
+                 {
+                     BenchmarkUtils::fillWithNoise(buffer, random);
+                     processor.processBlock(buffer, midi);
+                 }
+
+                 std::cout << processor.getProfilerReport();
+             } };
+}
@@ -0,0 +1,24 @@
+/*
+  ==============================================================================
+
+    ProfileReport.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Renders noise through one FlangerAudioProcessor and prints the report of
+    its built-in block profiler (and stage traces, if compiled in), exactly as
+    a plugin instance dumps it on destruction with FLANGER_PROFILE_DUMP.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+class ProfileReport
+{
+public:
+    static juce::ConsoleApplication::Command createCommand();
+};
@@ -0,0 +1,181 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyStress.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "RealtimeSafetyStress.h"
+#include "BenchmarkUtils.h"
+#include "../Source/PluginProcessor.h"
+#include "../Source/RealtimeSafety.h"
+
+// The command is only registered when the hooks are compiled in, see BenchmarkMain.cpp
+#if FLANGER_RT_SAFETY_CHECKS
+
+#include <atomic>
+#include <functional>
+#include <new>
+#include <thread>
+
+namespace
+{
+    const double sampleRates[] = { 22050.0, 44100.0, 48000.0, 88200.0, 96000.0, 192000.0 };
+    const int blockSizes[] = { 1, 16, 32, 64, 100, 128, 256, 441, 512, 1024, 2048 };
+    const int maximumBlockSize = 2048;
+
+    // Where the allocations of the self-check escape to, so that the compiler cannot elide them
+    void* volatile allocationSink = nullptr;
+
+    // Allocates on a marked audio thread in each form the hooks replace, and lists the forms they did not report
+    juce::StringArray findUnreportedAllocations()
+    {
+        // FlangerParameters::Snapshot is alignas(64), above the default new alignment: the std::align_val_t forms
+        using Aligned = FlangerParameters::Snapshot;
+
+        const std::pair<const char*, std::function<void()>> allocations[] =
+        {
+            { "operator new",                 [] { auto* p = new int(1); allocationSink = p; delete p; } },
+            { "operator new[]",               [] { auto* p = new float[64]; allocationSink = p; delete[] p; } },
+            { "nothrow operator new",         [] { auto* p = new (std::nothrow) int(1); allocationSink = p; delete p; } },
+            { "aligned operator new",         [] { auto p = std::make_unique<Aligned>(); allocationSink = p.get(); } },
+            { "aligned operator new[]",       [] { auto* p = new Aligned[2]; allocationSink = p; delete[] p; } },
+            { "nothrow aligned operator new", [] { auto* p = new (std::nothrow) Aligned; allocationSink = p; delete p; } },
+        };
+
+        juce::StringArray unreported;
+
+        for (const auto& allocation : allocations)
+        {
+            const int before = RealtimeSafety::getNumViolations();
+
+            {
+                RealtimeSafety::ScopedAudioThread audioThread;
+                allocation.second();
+            }
+
+            if (RealtimeSafety::getNumViolations() == before)
+                unreported.add(allocation.first);
+        }
+
+        RealtimeSafety::resetViolations();
+        return unreported;
+    }
+}
+
+//==============================================================================
+RealtimeSafetyStress::Result RealtimeSafetyStress::run(const Options& options)
+{
+    Result result;
+
+    // The run proves nothing if the hooks miss a form of allocation: check each of them first
+    result.unreportedAllocations = findUnreportedAllocations();
+
+    FlangerAudioProcessor processor;
+    processor.setRateAndBufferSizeDetails(48000.0, 512);
+    processor.prepareToPlay(48000.0, 512);
+
+    std::atomic<int> currentBlockSize { 512 };
+    std::atomic<bool> running { true };
+
+    RealtimeSafety::setTrapLocks(options.trapLocks);
+    RealtimeSafety::resetViolations();
+
+    // The audio thread: like a host, it holds the callback lock around processBlock, so that it never
+    // overlaps prepareToPlay. That lock is outside processBlock and is not a violation.
+    std::thread audioThread([&]
+    {
+        juce::AudioBuffer<float> buffer(2, maximumBlockSize);
+        juce::MidiBuffer midi;
+        juce::Random random(1);
+
+        while (running.load())
+        {
+            const juce::ScopedLock callbackLock(processor.getCallbackLock());
+
+            buffer.setSize(2, currentBlockSize.load(), false, false, true);
+            BenchmarkUtils::fillWithNoise(buffer, random);
+
+            processor.processBlock(buffer, midi);
+            ++result.numBlocks;
+        }
+    });
+
+    // The host/UI thread
+    juce::Random random(2);
+    auto& parameters = processor.getParameters();
+    juce::MemoryBlock state;
+
+    const auto endTime = juce::Time::getMillisecondCounterHiRes() + 1000.0 * options.seconds;
+
+    for (juce::int64 iteration = 0; juce::Time::getMillisecondCounterHiRes() < endTime; ++iteration)
+    {
+        for (auto* parameter : parameters)
+        {
+            parameter->setValueNotifyingHost(random.nextFloat());
+            ++result.numParameterChanges;
+        }
+
+        if (iteration % 8 == 0)
+        {
+            processor.getStateInformation(state);
+            processor.setStateInformation(state.getData(), (int)state.getSize());
+            ++result.numStateRestores;
+        }
+
+        if (iteration % 64 == 0)
+        {
+            const auto sampleRate = sampleRates[random.nextInt((int)juce::numElementsInArray(sampleRates))];
+            const auto blockSize = blockSizes[random.nextInt((int)juce::numElementsInArray(blockSizes))];
+
+            const juce::ScopedLock callbackLock(processor.getCallbackLock());
+            processor.releaseResources();
+            processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+            processor.prepareToPlay(sampleRate, blockSize);
+            currentBlockSize = blockSize;
+            ++result.numPrepares;
+        }
+    }
+
+    running = false;
+    audioThread.join();
+
+    result.numViolations = RealtimeSafety::getNumViolations();
+    return result;
+}
+
+//==============================================================================
+juce::ConsoleApplication::Command RealtimeSafetyStress::createCommand()
+{
+    return { "--rt-safety",
+             "--rt-safety [--seconds=10] [--trap-locks]",
+             "Stress test: fails if processBlock allocates (or locks, with --trap-locks) while parameters, state and prepareToPlay change",
+             "Violations are printed with a stack trace. Needs a build configured with -DFLANGER_RT_SAFETY_CHECKS=ON.",
+             [](const juce::ArgumentList& args)
+             {
+                 Options options;
+                 options.seconds = BenchmarkUtils::getDoubleOption(args, "--seconds", options.seconds);
+                 options.trapLocks = args.containsOption("--trap-locks");
+
+                 std::cout << "Checking that every form of allocation is reported (the reports below are expected)" << std::endl;
+
+                 const auto result = run(options);
+
+                 if (! result.unreportedAllocations.isEmpty())
+                     juce::ConsoleApplication::fail("The real-time safety hooks do not report: " + result.unreportedAllocations.joinIntoString(", "));
+
+                 std::cout << "Blocks processed:   " << result.numBlocks << std::endl
+                           << "Parameter changes:  " << result.numParameterChanges << std::endl
+                           << "State restores:     " << result.numStateRestores << std::endl
+                           << "prepareToPlay:      " << result.numPrepares << std::endl
+                           << "Violations:         " << result.numViolations << std::endl;
+
+                 if (result.numViolations > 0)
+                     juce::ConsoleApplication::fail("processBlock is not real-time safe");
+             } };
+}
+
+#endif // FLANGER_RT_SAFETY_CHECKS
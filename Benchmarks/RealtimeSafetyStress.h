@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyStress.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Runs processBlock on an audio thread while another thread hammers every
+    parameter, setStateInformation and prepareToPlay with changing sample rates
+    and block sizes. Fails if the audio thread allocated, or with --trap-locks
+    locked or slept, inside processBlock.
+
+    Needs a build configured with -DFLANGER_RT_SAFETY_CHECKS=ON.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+class RealtimeSafetyStress
+{
+public:
+    struct Options
+    {
+        double seconds = 10.0;
+        bool trapLocks = false;
+    };
+
+    struct Result
+    {
+        juce::int64 numBlocks = 0;
+        juce::int64 numParameterChanges = 0;
+        juce::int64 numStateRestores = 0;
+        juce::int64 numPrepares = 0;
+        int numViolations = 0;
+        juce::StringArray unreportedAllocations;    // forms of allocation the hooks missed in the self-check
+    };
+
+    static Result run(const Options& options);
+
+    static juce::ConsoleApplication::Command createCommand();
+};
@@ -0,0 +1,260 @@
+/*
+  ==============================================================================
+
+    ScalingBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "ScalingBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "PerfCounters.h"
+#include "../Source/PluginProcessor.h"
+
+#include <chrono>
+#include <thread>
+
+using IOProcessor = juce::AudioProcessorGraph::AudioGraphIOProcessor;
+
+//==============================================================================
+ScalingBenchmark::ScalingBenchmark(const Options& o)
+    : options(o)
+{
+}
+
+ScalingBenchmark::Result ScalingBenchmark::run(int numInstances, Topology topology)
+{
+    Result result;
+    result.topology = topology;
+    result.numInstances = numInstances;
+
+    const auto residentBefore = BenchmarkUtils::getResidentBytes();
+
+    juce::AudioProcessorGraph graph;
+    graph.setPlayConfigDetails(options.numChannels, options.numChannels, options.sampleRate, options.blockSize);
+
+    auto inputNode = graph.addNode(std::make_unique<IOProcessor>(IOProcessor::audioInputNode));
+    auto outputNode = graph.addNode(std::make_unique<IOProcessor>(IOProcessor::audioOutputNode));
+
+    auto connect = [&](juce::AudioProcessorGraph::NodeID source, juce::AudioProcessorGraph::NodeID destination)
+    {
+        for (int channel = 0; channel < options.numChannels; ++channel)
+            graph.addConnection({ { source, channel }, { destination, channel } });
+    };
+
+    // Every instance gets its own realistic settings, as on a real session. Feedback and gain are kept
+    // moderate and the polarity alternates so that a long serial chain doesn't run away in level.
+    juce::Random random(numInstances);
+    std::vector<FlangerAudioProcessor*> flangers;
+    auto previous = inputNode->nodeID;
+
+    for (int i = 0; i < numInstances; ++i)
+    {
+        auto node = graph.addNode(std::make_unique<FlangerAudioProcessor>());
+        auto* flanger = dynamic_cast<FlangerAudioProcessor*>(node->getProcessor());
+        flangers.push_back(flanger);
+
+        BenchmarkUtils::setParameter(flanger->apvts, "DELAY", 5.0f + 20.0f * random.nextFloat());
+        BenchmarkUtils::setParameter(flanger->apvts, "SWEEP", random.nextFloat());
+        BenchmarkUtils::setParameter(flanger->apvts, "SPEED", 0.1f + 4.0f * random.nextFloat());
+        BenchmarkUtils::setParameter(flanger->apvts, "WAVE", (float)random.nextInt(4));
+        BenchmarkUtils::setParameter(flanger->apvts, "INTERPOL", (float)random.nextInt(3));
+        BenchmarkUtils::setParameter(flanger->apvts, "FB", 0.3f);
+        BenchmarkUtils::setParameter(flanger->apvts, "FF", 0.5f);
+        BenchmarkUtils::setParameter(flanger->apvts, "PHASE", (float)(i % 2));
+        BenchmarkUtils::setParameter(flanger->apvts, "QUALITY", options.eco ? (float)flanger::kEcoQuality : (float)flanger::kHighQuality);
+        BenchmarkUtils::setParameter(flanger->apvts, "STORAGE", options.compact ? (float)flanger::kCompactStorage : (float)flanger::kFloatStorage);
+        node->setBypassed(options.bypassed);
+
+        if (topology == Topology::serial)
+        {
+            connect(previous, node->nodeID);
+            previous = node->nodeID;
+        }
+        else
+        {
+            connect(inputNode->nodeID, node->nodeID);
+            connect(node->nodeID, outputNode->nodeID);
+        }
+    }
+
+    if (topology == Topology::serial)
+        connect(previous, outputNode->nodeID);
+
+    // Preparing the graph builds its rendering sequence and prepares every node
+    graph.prepareToPlay(options.sampleRate, options.blockSize);
+
+    const auto residentAfter = BenchmarkUtils::getResidentBytes();
+
+    if (residentAfter > residentBefore)
+        result.residentBytesPerInstance = (residentAfter - residentBefore) / (size_t)numInstances;
+
+    if (! flangers.empty())
+        result.bytesPerInstance = sizeof(FlangerAudioProcessor) + flangers.front()->getDelayBufferBytes();
+
+    juce::AudioBuffer<float> buffer(options.numChannels, options.blockSize);
+    juce::MidiBuffer midi;
+
+    // A quarter of a second of warm-up, so the first measured callbacks don't pay for page faults
+    const int warmUpBlocks = juce::jmax(1, (int)(0.25 * options.sampleRate / options.blockSize));
+
+    for (int block = 0; block < warmUpBlocks; ++block)
+    {
+        BenchmarkUtils::fillWithNoise(buffer, random);
+        graph.processBlock(buffer, midi);
+    }
+
+    const double deadline = options.blockSize / options.sampleRate;
+    result.numBlocks = juce::jmax(1, (int)(options.seconds / deadline));
+
+    PerfCounters counters;
+    double totalSeconds = 0.0;
+    double worstSeconds = 0.0;
+
+    const auto callbackStart = std::chrono::steady_clock::now();
+    counters.start();
+
+    for (int block = 0; block < result.numBlocks; ++block)
+    {
+        BenchmarkUtils::fillWithNoise(buffer, random);
+        midi.clear();
+
+        // The simulated audio callback
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        graph.processBlock(buffer, midi);
+        const auto elapsed = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+
+        totalSeconds += elapsed;
+        worstSeconds = juce::jmax(worstSeconds, elapsed);
+
+        if (elapsed > deadline)
+            ++result.deadlineMisses;
+
+        if (options.paced)
+            std::this_thread::sleep_until(callbackStart + std::chrono::duration<double>((block + 1) * deadline));
+    }
+
+    counters.stop();
+
+    const double audioSeconds = result.numBlocks * deadline;
+    result.dspLoad = totalSeconds / audioSeconds;
+    result.worstBlockLoad = worstSeconds / deadline;
+    result.nanosPerSamplePerInstance = 1.0e9 * totalSeconds
+                                     / ((double)result.numBlocks * options.blockSize * numInstances);
+
+    if (counters.isAvailable())
+    {
+        const auto references = counters.getCacheReferences();
+        const auto misses = counters.getCacheMisses();
+
+        result.cacheMissesPerBlock = (double)misses / result.numBlocks;
+        result.cacheMissRatio = references > 0 ? (double)misses / (double)references : 0.0;
+    }
+
+    graph.releaseResources();
+    return result;
+}
+
+//==============================================================================
+void ScalingBenchmark::printHeader(const Options& options)
+{
+    if (options.csv)
+    {
+        std::cout << "topology,instances,dsp_load,worst_block_load,deadline_misses,blocks,"
+                     "ns_per_sample_per_instance,bytes_per_instance,resident_bytes_per_instance,"
+                     "cache_misses_per_block,cache_miss_ratio,instances_per_core" << std::endl;
+        return;
+    }
+
+    std::cout << "Flanger scaling: " << options.sampleRate << " Hz, " << options.blockSize << " samples, "
+              << options.numChannels << " channels, " << options.seconds << " s per run"
+              << (options.paced ? ", paced" : "") << (options.eco ? ", eco quality" : "")
+              << (options.compact ? ", compact delay lines" : "") << (options.bypassed ? ", bypassed" : "") << std::endl << std::endl;
+
+    std::cout << juce::String("topology").paddedRight(' ', 10)
+              << juce::String("N").paddedLeft(' ', 5)
+              << juce::String("load %").paddedLeft(' ', 10)
+              << juce::String("worst %").paddedLeft(' ', 10)
+              << juce::String("misses").paddedLeft(' ', 8)
+              << juce::String("ns/smp/inst").paddedLeft(' ', 13)
+              << juce::String("bytes/inst").paddedLeft(' ', 12)
+              << juce::String("RSS/inst").paddedLeft(' ', 12)
+              << juce::String("LLC miss/blk").paddedLeft(' ', 14)
+              << juce::String("miss ratio").paddedLeft(' ', 12)
+              << juce::String("inst/core").paddedLeft(' ', 11) << std::endl;
+}
+
+void ScalingBenchmark::printResult(const Options& options, const Result& r)
+{
+    const juce::String topology = r.topology == Topology::serial ? "serial" : "parallel";
+    const double instancesPerCore = r.dspLoad > 0.0 ? r.numInstances / r.dspLoad : 0.0;
+    const bool hasCounters = r.cacheMissesPerBlock >= 0.0;
+
+    if (options.csv)
+    {
+        std::cout << topology << ',' << r.numInstances << ',' << r.dspLoad << ',' << r.worstBlockLoad << ','
+                  << r.deadlineMisses << ',' << r.numBlocks << ',' << r.nanosPerSamplePerInstance << ','
+                  << r.bytesPerInstance << ',' << r.residentBytesPerInstance << ','
+                  << (hasCounters ? juce::String(r.cacheMissesPerBlock) : juce::String()) << ','
+                  << (hasCounters ? juce::String(r.cacheMissRatio) : juce::String()) << ','
+                  << instancesPerCore << std::endl;
+        return;
+    }
+
+    std::cout << topology.paddedRight(' ', 10)
+              << juce::String(r.numInstances).paddedLeft(' ', 5)
+              << juce::String(100.0 * r.dspLoad, 2).paddedLeft(' ', 10)
+              << juce::String(100.0 * r.worstBlockLoad, 2).paddedLeft(' ', 10)
+              << juce::String(r.deadlineMisses).paddedLeft(' ', 8)
+              << juce::String(r.nanosPerSamplePerInstance, 2).paddedLeft(' ', 13)
+              << juce::String((juce::int64)r.bytesPerInstance).paddedLeft(' ', 12)
+              << juce::String((juce::int64)r.residentBytesPerInstance).paddedLeft(' ', 12)
+              << (hasCounters ? juce::String(r.cacheMissesPerBlock, 1) : juce::String("n/a")).paddedLeft(' ', 14)
+              << (hasCounters ? juce::String(r.cacheMissRatio, 3) : juce::String("n/a")).paddedLeft(' ', 12)
+              << juce::String(instancesPerCore, 1).paddedLeft(' ', 11) << std::endl;
+}
+
+//==============================================================================
+juce::ConsoleApplication::Command ScalingBenchmark::createCommand()
+{
+    return { "--scaling",
+             "--scaling [--sample-rate=48000] [--block=128] [--channels=2] [--seconds=2] [--max-instances=512] [--serial|--parallel] [--paced] [--eco] [--compact] [--bypassed] [--csv]",
+             "Measures DSP load, deadline misses, memory and cache misses of 1..N instances in an AudioProcessorGraph",
+             "Instance counts double from 1 up to --max-instances. Without --serial or --parallel both topologies are measured. "
+             "--eco runs every instance in the Eco quality mode, --compact with 16-bit delay lines. --bypassed bypasses every instance.",
+             [](const juce::ArgumentList& args)
+             {
+                 Options options;
+                 options.sampleRate = BenchmarkUtils::getDoubleOption(args, "--sample-rate", options.sampleRate);
+                 options.blockSize = BenchmarkUtils::getIntOption(args, "--block", options.blockSize);
+                 options.numChannels = BenchmarkUtils::getIntOption(args, "--channels", options.numChannels);
+                 options.seconds = BenchmarkUtils::getDoubleOption(args, "--seconds", options.seconds);
+                 options.maxInstances = BenchmarkUtils::getIntOption(args, "--max-instances", options.maxInstances);
+                 options.paced = args.containsOption("--paced");
+                 options.eco = args.containsOption("--eco");
+                 options.compact = args.containsOption("--compact");
+                 options.bypassed = args.containsOption("--bypassed");
+                 options.csv = args.containsOption("--csv");
+
+                 if (options.sampleRate <= 0.0 || options.blockSize <= 0 || options.seconds <= 0.0
+                     || options.maxInstances < 1 || options.numChannels < 1 || options.numChannels > 2)
+                     juce::ConsoleApplication::fail("Invalid scaling options, see --help");
+
+                 juce::Array<Topology> topologies;
+
+                 if (! args.containsOption("--parallel"))
+                     topologies.add(Topology::serial);
+
+                 if (! args.containsOption("--serial"))
+                     topologies.add(Topology::parallel);
+
+                 ScalingBenchmark benchmark(options);
+                 printHeader(options);
+
+                 for (auto topology : topologies)
+                     for (int numInstances = 1; numInstances <= options.maxInstances; numInstances *= 2)
+                         printResult(options, benchmark.run(numInstances, topology));
+             } };
+}
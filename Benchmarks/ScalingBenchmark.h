@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    ScalingBenchmark.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Multi-instance scaling: N FlangerAudioProcessor nodes in an
+    AudioProcessorGraph, wired in series or in parallel, driven by a simulated
+    audio callback. Reports DSP load, deadline misses, memory and cache misses
+    as N grows, i.e. how many instances fit on one core.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+class ScalingBenchmark
+{
+public:
+    enum class Topology
+    {
+        serial,
+        parallel
+    };
+
+    struct Options
+    {
+        double sampleRate = 48000.0;
+        int blockSize = 128;
+        int numChannels = 2;
+        double seconds = 2.0;       // audio time rendered per measurement
+        int maxInstances = 512;
+        bool paced = false;         // wait for each callback's deadline, like a real device would
+        bool eco = false;           // run every instance in kEcoQuality
+        bool compact = false;       // 16-bit delay lines (kCompactStorage) in every instance
+        bool bypassed = false;      // bypass every node, which runs processBlockBypassed()
+        bool csv = false;
+    };
+
+    struct Result
+    {
+        Topology topology = Topology::serial;
+        int numInstances = 0;
+        int numBlocks = 0;
+        int deadlineMisses = 0;
+        double dspLoad = 0.0;           // processing time / audio time
+        double worstBlockLoad = 0.0;    // slowest callback / deadline
+        double nanosPerSamplePerInstance = 0.0;
+        size_t bytesPerInstance = 0;    // object size plus delay lines
+        size_t residentBytesPerInstance = 0;
+        double cacheMissesPerBlock = -1.0;
+        double cacheMissRatio = -1.0;
+    };
+
+    explicit ScalingBenchmark(const Options& options);
+
+    Result run(int numInstances, Topology topology);
+
+    static void printHeader(const Options& options);
+    static void printResult(const Options& options, const Result& result);
+
+    static juce::ConsoleApplication::Command createCommand();
+
+private:
+    Options options;
+};
@@ -0,0 +1,167 @@
+/*
+  ==============================================================================
+
+    StartupBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "StartupBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "../Source/PluginProcessor.h"
+
+namespace
+{
+    template <typename Function>
+    double timeMilliseconds(Function&& function)
+    {
+        const auto start = juce::Time::getHighResolutionTicks();
+        function();
+        return 1000.0 * juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+    }
+
+    void printRow(const juce::String& name, double firstMs, double meanMs)
+    {
+        std::cout << name.paddedRight(' ', 24)
+                  << juce::String(firstMs, 3).paddedLeft(' ', 12)
+                  << juce::String(meanMs, 3).paddedLeft(' ', 12) << std::endl;
+    }
+
+    // A bundle (.vst3 on Linux and macOS) is a directory: its size is the sum of its files
+    juce::int64 getSizeOnDisk(const juce::File& file)
+    {
+        if (! file.isDirectory())
+            return file.getSize();
+
+        juce::int64 size = 0;
+
+        for (const auto& child : file.findChildFiles(juce::File::findFiles, true))
+            size += child.getSize();
+
+        return size;
+    }
+
+    void benchmarkConstruction(int numInstances)
+    {
+        double firstLayoutMs = 0.0, totalLayoutMs = 0.0;
+
+        for (int i = 0; i < numInstances; ++i)
+        {
+            const double ms = timeMilliseconds([] { auto layout = FlangerParameters::createLayout(); });
+            totalLayoutMs += ms;
+
+            if (i == 0)
+                firstLayoutMs = ms;
+        }
+
+        std::vector<std::unique_ptr<FlangerAudioProcessor>> processors;
+        processors.reserve((size_t)numInstances);
+
+        double firstConstructionMs = 0.0, totalConstructionMs = 0.0;
+        const size_t residentBefore = BenchmarkUtils::getResidentBytes();
+
+        for (int i = 0; i < numInstances; ++i)
+        {
+            const double ms = timeMilliseconds([&] { processors.push_back(std::make_unique<FlangerAudioProcessor>()); });
+            totalConstructionMs += ms;
+
+            if (i == 0)
+                firstConstructionMs = ms;
+        }
+
+        const size_t residentAfter = BenchmarkUtils::getResidentBytes();
+
+        const double destructionMs = timeMilliseconds([&] { processors.clear(); });
+
+        std::cout << "Flanger startup: " << numInstances << " instances" << std::endl << std::endl;
+        std::cout << juce::String("step").paddedRight(' ', 24)
+                  << juce::String("first ms").paddedLeft(' ', 12)
+                  << juce::String("mean ms").paddedLeft(' ', 12) << std::endl;
+
+        printRow("createLayout", firstLayoutMs, totalLayoutMs / numInstances);
+        printRow("FlangerAudioProcessor()", firstConstructionMs, totalConstructionMs / numInstances);
+        printRow("~FlangerAudioProcessor()", 0.0, destructionMs / numInstances);
+
+        if (residentAfter > residentBefore)
+            std::cout << std::endl << "Resident memory per instance: "
+                      << juce::File::descriptionOfSizeInBytes((juce::int64)((residentAfter - residentBefore) / (size_t)numInstances)) << std::endl;
+    }
+
+    void benchmarkPlugin(const juce::File& plugin, int numScans)
+    {
+        if (! plugin.exists())
+            juce::ConsoleApplication::fail("No plugin at " + plugin.getFullPathName());
+
+        std::cout << std::endl << "Plugin: " << plugin.getFullPathName() << std::endl;
+        std::cout << "Size on disk: " << getSizeOnDisk(plugin) << " bytes" << std::endl << std::endl;
+
+        // The first scan loads the module; the later ones find it loaded, as a host rescanning does
+        juce::VST3PluginFormat format;
+        juce::OwnedArray<juce::PluginDescription> types;
+        double firstScanMs = 0.0, totalScanMs = 0.0;
+
+        for (int i = 0; i < numScans; ++i)
+        {
+            types.clear();
+            const double ms = timeMilliseconds([&] { format.findAllTypesForFile(types, plugin.getFullPathName()); });
+            totalScanMs += ms;
+
+            if (i == 0)
+                firstScanMs = ms;
+        }
+
+        if (types.isEmpty())
+            juce::ConsoleApplication::fail("No VST3 plugin found in " + plugin.getFullPathName());
+
+        double firstLoadMs = 0.0, totalLoadMs = 0.0;
+
+        for (int i = 0; i < numScans; ++i)
+        {
+            juce::String error;
+            std::unique_ptr<juce::AudioPluginInstance> instance;
+
+            const double ms = timeMilliseconds([&] { instance = format.createInstanceFromDescription(*types[0], 48000.0, 512, error); });
+
+            if (instance == nullptr)
+                juce::ConsoleApplication::fail("Could not load the plugin: " + error);
+
+            totalLoadMs += ms;
+
+            if (i == 0)
+                firstLoadMs = ms;
+        }
+
+        std::cout << juce::String("step").paddedRight(' ', 24)
+                  << juce::String("first ms").paddedLeft(' ', 12)
+                  << juce::String("mean ms").paddedLeft(' ', 12) << std::endl;
+
+        printRow("scan", firstScanMs, totalScanMs / numScans);
+        printRow("load", firstLoadMs, totalLoadMs / numScans);
+    }
+}
+
+//==============================================================================
+juce::ConsoleApplication::Command StartupBenchmark::createCommand()
+{
+    return { "--startup",
+             "--startup [--instances=100] [--plugin=path/to/Flanger.vst3] [--scans=10]",
+             "Times the construction of the processor and, given a built VST3, its scan and load",
+             "Builds the parameter layout alone, then constructs and destroys the processors, reporting the first and the mean "
+             "time of each step and the resident memory per instance. With --plugin, also reports the size of the bundle and "
+             "times VST3PluginFormat::findAllTypesForFile (the scan) and createInstanceFromDescription (the load).",
+             [](const juce::ArgumentList& args)
+             {
+                 const int numInstances = BenchmarkUtils::getIntOption(args, "--instances", 100);
+                 const int numScans = BenchmarkUtils::getIntOption(args, "--scans", 10);
+
+                 if (numInstances < 1 || numScans < 1)
+                     juce::ConsoleApplication::fail("Invalid startup options, see --help");
+
+                 benchmarkConstruction(numInstances);
+
+                 if (args.containsOption("--plugin"))
+                     benchmarkPlugin(juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--plugin")), numScans);
+             } };
+}
@@ -0,0 +1,24 @@
+/*
+  ==============================================================================
+
+    StartupBenchmark.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    What a render node pays before the first block: building the parameter
+    layout, constructing FlangerAudioProcessor, and, given a built plugin,
+    the size of the bundle and the time a host takes to scan and load it.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+class StartupBenchmark
+{
+public:
+    static juce::ConsoleApplication::Command createCommand();
+};
@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    FlangerAdaptiveQuality.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "FlangerAdaptiveQuality.h"
+
+namespace flanger
+{
+
+//==============================================================================
+void AdaptiveQuality::reset() noexcept
+{
+    blocksSinceStep = 0;
+
+    level.store(kFullQuality, std::memory_order_relaxed);
+    smoothedLoad.store(0.0f, std::memory_order_relaxed);
+    numStepsDown.store(0, std::memory_order_relaxed);
+    numStepsUp.store(0, std::memory_order_relaxed);
+}
+
+void AdaptiveQuality::addBlockLoad(float load) noexcept
+{
+    // Single writer: relaxed loads and stores, as in BlockProfiler
+    const float previous = smoothedLoad.load(std::memory_order_relaxed);
+    const float smoothed = previous + policy.smoothing * (load - previous);
+    smoothedLoad.store(smoothed, std::memory_order_relaxed);
+
+    if (++blocksSinceStep < policy.holdBlocks)
+        return;
+
+    const int current = level.load(std::memory_order_relaxed);
+
+    if (smoothed > policy.stepDownLoad && current < kNumLevels - 1)
+    {
+        level.store(current + 1, std::memory_order_relaxed);
+        numStepsDown.store(numStepsDown.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        blocksSinceStep = 0;
+    }
+    else if (smoothed < policy.stepUpLoad && current > kFullQuality)
+    {
+        level.store(current - 1, std::memory_order_relaxed);
+        numStepsUp.store(numStepsUp.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        blocksSinceStep = 0;
+    }
+}
+
+Parameters AdaptiveQuality::apply(const Parameters& requested) const noexcept
+{
+    Parameters params = requested;
+    const int current = level.load(std::memory_order_relaxed);
+
+    if (current >= kLinearTaps)
+        params.interpol = kLinear;
+
+    if (current >= kControlRate)
+        params.quality = kEcoQuality;
+
+    return params;
+}
+
+AdaptiveQuality::State AdaptiveQuality::getState() const noexcept
+{
+    State state;
+    state.level = level.load(std::memory_order_relaxed);
+    state.smoothedLoad = smoothedLoad.load(std::memory_order_relaxed);
+    state.numStepsDown = numStepsDown.load(std::memory_order_relaxed);
+    state.numStepsUp = numStepsUp.load(std::memory_order_relaxed);
+    return state;
+}
+
+const char* AdaptiveQuality::getLevelName(int level) noexcept
+{
+    switch (level)
+    {
+    case kFullQuality:  return "full quality";
+    case kLinearTaps:   return "linear taps";
+    case kControlRate:  return "control rate";
+    default:            return "unknown";
+    }
+}
+
+} // namespace flanger
@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    FlangerAdaptiveQuality.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Steps the processing quality down when the blocks get close to their
+    deadline, and back up when the load drops.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "FlangerCore.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace flanger
+{
+
+//==============================================================================
+/**
+    Load-driven quality governor.
+
+    The audio thread feeds it the load of every block (block duration over
+    its deadline, see BlockProfiler::getLastLoad()) and asks it to degrade
+    the requested parameters. The load is smoothed, and the level moves one
+    step at a time with hysteresis and a hold time, so a single slow block
+    does not make it oscillate:
+
+        kFullQuality  ->  kLinearTaps  ->  kControlRate
+        as requested      cubic/quadratic   kEcoQuality
+                          read as linear
+
+    Every step changes how FlangerCore reads its delay lines, which it
+    crossfades over one block. Any thread can read the state for monitoring.
+*/
+class AdaptiveQuality
+{
+public:
+    enum Level
+    {
+        kFullQuality = 0,
+        kLinearTaps = 1,
+        kControlRate = 2,
+        kNumLevels = 3
+    };
+
+    struct Policy
+    {
+        // Loads are fractions of the block deadline taken by this instance alone
+        float stepDownLoad = 0.05f;     // smoothed load above which the quality steps down
+        float stepUpLoad = 0.02f;       // smoothed load below which it steps back up
+        float smoothing = 0.1f;         // weight of each new block in the smoothed load
+        int holdBlocks = 64;            // blocks to wait after a step before the next one
+    };
+
+    struct State
+    {
+        int level;
+        float smoothedLoad;
+        uint64_t numStepsDown;
+        uint64_t numStepsUp;
+    };
+
+    AdaptiveQuality() noexcept { reset(); }
+
+    // Not thread-safe: call before processing, e.g. from prepareToPlay()
+    void setPolicy(const Policy& newPolicy) noexcept { policy = newPolicy; }
+    const Policy& getPolicy() const noexcept { return policy; }
+
+    // Back to full quality with the statistics cleared
+    void reset() noexcept;
+
+    // Audio thread only: updates the level with the load of the last block
+    void addBlockLoad(float load) noexcept;
+
+    // Audio thread only: the requested parameters, degraded to the current level
+    Parameters apply(const Parameters& requested) const noexcept;
+
+    int getLevel() const noexcept { return level.load(std::memory_order_relaxed); }
+    State getState() const noexcept;
+
+    static const char* getLevelName(int level) noexcept;
+
+private:
+    Policy policy;
+
+    int blocksSinceStep = 0;
+
+    std::atomic<int> level;
+    std::atomic<float> smoothedLoad;
+    std::atomic<uint64_t> numStepsDown;
+    std::atomic<uint64_t> numStepsUp;
+};
+
+} // namespace flanger
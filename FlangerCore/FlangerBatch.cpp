@@ -0,0 +1,239 @@
+/*
+  ==============================================================================
+
+    FlangerBatch.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "FlangerBatch.h"
+#include "FlangerKernels.h"
+
+#include <algorithm>
+
+namespace flanger
+{
+
+//==============================================================================
+namespace
+{
+    // Shapes blended by the weights of the lanes, see FlangerBatch::shapeWeights
+    const int kNumShapes = 4;
+
+    /** LFO and read of every lane for one sample: the wet sample of each lane from its delay line, which
+        this loop only reads, so the lanes are independent. The stores are restrict-qualified, or the
+        compiler could not gather from the delay lines, for all it knows written through them. */
+    template <int readMode>
+    void readLanes(const float* __restrict delayLines, float* __restrict phases, float* __restrict wet,
+                   const float* phaseIncrements, const float* delays, const float* sweeps, const float* shapeWeights,
+                   int numLanes, int length, float writePosition, float samplesPerSecond) noexcept
+    {
+        const float lengthF = (float)length;
+        const float* sineWeights = shapeWeights;
+        const float* triangleWeights = shapeWeights + numLanes;
+        const float* squareWeights = shapeWeights + 2 * numLanes;
+        const float* sawWeights = shapeWeights + 3 * numLanes;
+
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            const float phase = phases[lane];
+
+            // The LFO of the lane: its shape times 1 plus the others times 0, which is exactly its shape
+            const float lfo = kernels::sineShape(phase) * sineWeights[lane] + kernels::triangleShape(phase) * triangleWeights[lane]
+                            + kernels::squareShape(phase) * squareWeights[lane] + kernels::sawShape(phase) * sawWeights[lane];
+
+            const float delay = (delays[lane] + sweeps[lane] * lfo) * samplesPerSecond;
+
+            // The read position of FlangerCore::readDelayLine(). It lies within one length of the buffer,
+            // so a conditional wrap gives exactly what fmodf does there.
+            const float position = writePosition - delay + lengthF - 3;
+            float dpr = position >= lengthF ? position - lengthF : (position < 0.0f ? position + lengthF : position);
+
+            // Adding the length to a tiny negative position can round up to the length itself
+            dpr = dpr < lengthF ? dpr : 0.0f;
+
+            const int sample1 = (int)dpr;
+            const float fraction = dpr - (float)sample1;
+            const int sample2 = sample1 + 1 < length ? sample1 + 1 : 0;
+
+            // The sample of this lane at a row. The index is unsigned 32-bit: signed ones are widened to 64 bits,
+            // which keeps GCC from gathering.
+            auto at = [&](int row) noexcept { return delayLines[(unsigned int)(row * numLanes + lane)]; };
+
+            if (readMode == kCubic)
+            {
+                const int sample0 = sample1 > 0 ? sample1 - 1 : length - 1;
+                const int sample3 = sample2 + 1 < length ? sample2 + 1 : 0;
+
+                wet[lane] = kernels::interpolateCubic(fraction, at(sample0), at(sample1), at(sample2), at(sample3));
+            }
+            else if (readMode == kQuadratic)
+            {
+                const int sample0 = sample1 > 0 ? sample1 - 1 : length - 1;
+
+                wet[lane] = kernels::interpolateQuadratic(fraction, at(sample0), at(sample1), at(sample2));
+            }
+            else
+            {
+                wet[lane] = kernels::interpolateLinear(fraction, at(sample1), at(sample2));
+            }
+
+            // Update the LFO phase, normalizing its value in the range 0-1. setParameters() keeps the increments
+            // in 0-0.5, so the phase is never negative and truncating is floor(), in a form SSE2 can vectorise.
+            const float nextPhase = phase + phaseIncrements[lane];
+            phases[lane] = nextPhase - (float)(int)nextPhase;
+        }
+    }
+}
+
+//==============================================================================
+void FlangerBatch::prepare(double newSampleRate, int newNumLanes, int newMaximumBlockSize,
+                           int newInterpolation, int newDelayRange)
+{
+    sampleRate = newSampleRate;
+    inverseSampleRate = 1.0 / newSampleRate;
+    numLanes = std::max(0, newNumLanes);
+    maximumBlockSize = std::max(1, newMaximumBlockSize);
+    interpolation = newInterpolation == kQuadratic || newInterpolation == kCubic ? newInterpolation : (int)kLinear;
+    delayRange = newDelayRange == kChorusRange || newDelayRange == kDoublerRange ? newDelayRange : (int)kFlangeRange;
+    delayLineLength = FlangerCore::getDelayLineLength(delayRange, newSampleRate);
+
+    // Like the pool of FlangerCore, it only grows; reset() clears the part in use
+    const size_t poolSize = (size_t)numLanes * (size_t)delayLineLength;
+
+    if (poolSize > delayPoolSize)
+    {
+        delayPool.reset(new float[poolSize]);
+        delayPoolSize = poolSize;
+    }
+
+    // resize() keeps the capacity when shrinking, so re-preparing with fewer lanes or smaller blocks never allocates
+    phases.resize((size_t)numLanes);
+    phaseIncrements.resize((size_t)numLanes);
+    delays.resize((size_t)numLanes);
+    sweeps.resize((size_t)numLanes);
+    feedbacks.resize((size_t)numLanes);
+    wetGains.resize((size_t)numLanes);
+    shapeWeights.resize((size_t)kNumShapes * (size_t)numLanes);
+    wetBuffer.resize((size_t)numLanes);
+    frameBuffer.resize((size_t)numLanes * (size_t)maximumBlockSize);
+
+    const Parameters defaults;
+
+    for (int lane = 0; lane < numLanes; ++lane)
+        setParameters(lane, defaults);
+
+    reset();
+}
+
+void FlangerBatch::reset() noexcept
+{
+    if (delayPool != nullptr)
+        std::fill(delayPool.get(), delayPool.get() + (size_t)numLanes * (size_t)delayLineLength, 0.0f);
+
+    std::fill(phases.begin(), phases.end(), 0.0f);
+    delayWrite = 0;
+}
+
+void FlangerBatch::resetLane(int lane) noexcept
+{
+    if (lane < 0 || lane >= numLanes)
+        return;
+
+    for (int row = 0; row < delayLineLength; ++row)
+        delayPool[(size_t)row * (size_t)numLanes + (size_t)lane] = 0.0f;
+
+    phases[(size_t)lane] = 0.0f;
+}
+
+void FlangerBatch::setParameters(int lane, const Parameters& params) noexcept
+{
+    if (lane < 0 || lane >= numLanes)
+        return;
+
+    // The same limits as FlangerCore::process(): the delay and the sweep stay 4 samples short of the end of the lines,
+    // and the LFO speed within half the sample rate
+    const float longestDelay = (float)((double)(delayLineLength - 4) * inverseSampleRate);
+    const float sweep = std::min(std::max(params.sweep, 0.0f), FlangerCore::kMaximumSweepWidth);
+
+    // One weight of 1 selects the shape of the lane. The other shapes hold the delay at its base: no sweep.
+    const bool periodic = params.wave >= kSineWave && params.wave <= kSawWave;
+
+    for (int shape = 0; shape < kNumShapes; ++shape)
+        shapeWeights[(size_t)shape * (size_t)numLanes + (size_t)lane] = shape == params.wave ? 1.0f : 0.0f;
+
+    phaseIncrements[(size_t)lane] = (float)(FlangerCore::limitSpeed(params.speed, sampleRate) * inverseSampleRate);
+    delays[(size_t)lane] = std::min(std::max(params.delay, 0.0f), std::max(0.0f, longestDelay - sweep));
+    sweeps[(size_t)lane] = periodic ? sweep : 0.0f;
+    feedbacks[(size_t)lane] = params.feedback;
+    wetGains[(size_t)lane] = params.gain * (params.polarity == 1 ? -1.0f : 1.0f);
+}
+
+//==============================================================================
+void FlangerBatch::processInterleaved(const float* input, float* output, int numSamples) noexcept
+{
+    if (delayPool == nullptr || numLanes == 0 || numSamples <= 0)
+        return;
+
+    switch (interpolation)
+    {
+    case kQuadratic:    processFrames<kQuadratic>(input, output, numSamples); break;
+    case kCubic:        processFrames<kCubic>(input, output, numSamples); break;
+    case kLinear:
+    default:            processFrames<kLinear>(input, output, numSamples); break;
+    }
+}
+
+void FlangerBatch::process(const float* const* input, float* const* output, int numSamples) noexcept
+{
+    const size_t lanes = (size_t)numLanes;
+    float* frames = frameBuffer.data();
+
+    for (int startSample = 0; startSample < numSamples; startSample += maximumBlockSize)
+    {
+        const int blockSize = std::min(maximumBlockSize, numSamples - startSample);
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+            for (int i = 0; i < blockSize; ++i)
+                frames[(size_t)i * lanes + lane] = input[lane][startSample + i];
+
+        processInterleaved(frames, frames, blockSize);
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+            for (int i = 0; i < blockSize; ++i)
+                output[lane][startSample + i] = frames[(size_t)i * lanes + lane];
+    }
+}
+
+template <int readMode>
+void FlangerBatch::processFrames(const float* input, float* output, int numSamples) noexcept
+{
+    const size_t lanes = (size_t)numLanes;
+    const float samplesPerSecond = (float)sampleRate;
+    float* const wet = wetBuffer.data();
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        readLanes<readMode>(delayPool.get(), phases.data(), wet, phaseIncrements.data(), delays.data(), sweeps.data(),
+                            shapeWeights.data(), numLanes, delayLineLength, (float)delayWrite, samplesPerSecond);
+
+        // Feedback into the row of the write position, and output; the input of a lane is read before its output is written
+        const float* in = input + (size_t)i * lanes;
+        float* out = output + (size_t)i * lanes;
+        float* row = delayPool.get() + (size_t)delayWrite * lanes;
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            const float x = in[lane];
+            row[lane] = x + wet[lane] * feedbacks[lane];
+            out[lane] = x + wetGains[lane] * wet[lane];
+        }
+
+        if (++delayWrite >= delayLineLength)
+            delayWrite = 0;
+    }
+}
+
+} // namespace flanger
@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+    FlangerBatch.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Many independent mono flangers processed together, one stream per lane,
+    for servers that run hundreds of short streams at once.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "FlangerCore.h"
+
+#include <memory>
+#include <vector>
+
+namespace flanger
+{
+
+//==============================================================================
+/**
+    K independent mono flangers, stored structure-of-arrays: one array per
+    piece of state (LFO phase, delay, sweep, gains) with one entry per lane,
+    and delay lines interleaved so that row n holds sample n of every lane.
+
+    Each sample runs two loops over the lanes, with no dependency from one
+    lane to the next, which the compiler vectorises: the LFO and the reads
+    of the delay lines (a gather, since every lane reads at its own delay),
+    then the feedback and the output, contiguous. The throughput grows with
+    the vector width and the lane count, even for mono streams in small
+    blocks, where a single FlangerCore has nothing to vectorise across.
+
+    A lane computes exactly what a mono FlangerCore does in kHighQuality
+    with the same parameters, through the same kernels (FlangerKernels.h):
+    the sine, triangle, square and saw LFOs, the feedback, the gain and the
+    polarity. The interpolator and the delay range decide the loop and the
+    length of the delay lines, so they are the same for every lane and set
+    by prepare(). The batch has no envelope follower, sidechain, barberpole,
+    modulation matrix, compact storage or crossfades, and the lanes ignore
+    those parameters; the random and wavetable LFOs hold the delay at its
+    base.
+
+    Only prepare() allocates, and only when it needs more than any earlier
+    call. Lanes can be recycled for new streams with resetLane(). All the
+    lanes write their delay lines at the same position, so a recycled lane
+    matches a fresh FlangerCore to within rounding rather than exactly.
+*/
+class FlangerBatch
+{
+public:
+    FlangerBatch() = default;
+
+    // Prepares every lane with the default Parameters, delay lines and LFOs cleared
+    void prepare(double newSampleRate, int newNumLanes, int newMaximumBlockSize,
+                 int newInterpolation = kLinear, int newDelayRange = kFlangeRange);
+
+    // Clears every delay line and LFO
+    void reset() noexcept;
+
+    // Clears the delay line and the LFO of one lane, for a new stream; the other lanes carry on
+    void resetLane(int lane) noexcept;
+
+    // Settings of a lane from the next block on; interpol and delayRange come from prepare()
+    void setParameters(int lane, const Parameters& params) noexcept;
+
+    /** Processes numSamples frames, sample i of lane l being at [i * getNumLanes() + l].
+        Input and output may point to the same memory. Any number of samples. */
+    void processInterleaved(const float* input, float* output, int numSamples) noexcept;
+
+    /** Processes numSamples samples of one mono buffer per lane, going through a block
+        of interleaved frames. Input and output may point to the same memory. */
+    void process(const float* const* input, float* const* output, int numSamples) noexcept;
+
+    double getSampleRate() const noexcept { return sampleRate; }
+    int getNumLanes() const noexcept { return numLanes; }
+    int getInterpolation() const noexcept { return interpolation; }
+    int getDelayLineLength() const noexcept { return delayLineLength; }
+
+    // Heap memory owned by the batch: the delay lines, the per-lane state and the frame block
+    size_t getMemoryBytes() const noexcept
+    {
+        return delayPoolSize * sizeof(float) + frameBuffer.capacity() * sizeof(float)
+             + (phases.capacity() + phaseIncrements.capacity() + delays.capacity() + sweeps.capacity()
+                + feedbacks.capacity() + wetGains.capacity() + shapeWeights.capacity() + wetBuffer.capacity()) * sizeof(float);
+    }
+
+private:
+    template <int readMode>
+    void processFrames(const float* input, float* output, int numSamples) noexcept;
+
+    double sampleRate = 44100.0;
+    double inverseSampleRate = 1.0 / 44100.0;
+    int numLanes = 0;
+    int maximumBlockSize = 0;
+    int interpolation = kLinear;
+    int delayRange = kFlangeRange;
+
+    // Interleaved delay lines: delayLineLength rows of numLanes samples, all written at the same position
+    int delayLineLength = 1;
+    std::unique_ptr<float[]> delayPool;
+    size_t delayPoolSize = 0;
+    int delayWrite = 0;
+
+    // Per-lane state, one entry per lane. The delay and sweep are in seconds, limited to the delay lines
+    // as FlangerCore::process() limits them; the wet gain includes the polarity. The LFO shape is a row of
+    // weights per shape (sine, triangle, square, saw), 1 for the shape of the lane and 0 for the others:
+    // multiplying beats selecting for lanes with different shapes in the same vector.
+    std::vector<float> phases;
+    std::vector<float> phaseIncrements;
+    std::vector<float> delays;
+    std::vector<float> sweeps;
+    std::vector<float> feedbacks;
+    std::vector<float> wetGains;
+    std::vector<float> shapeWeights;
+
+    std::vector<float> wetBuffer;       // the wet sample of every lane, between the two lane loops
+    std::vector<float> frameBuffer;     // process(): maximumBlockSize frames
+};
+
+} // namespace flanger
@@ -0,0 +1,1196 @@
+/*
+  ==============================================================================
+
+    FlangerCore.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "FlangerCore.h"
+#include "FlangerKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+namespace flanger
+{
+
+constexpr float FlangerCore::kMaximumDelay;
+constexpr float FlangerCore::kMaximumSweepWidth;
+constexpr float FlangerCore::kLongestDelay;
+constexpr float FlangerCore::kCompactFullScale;
+constexpr double FlangerCore::kPoolSampleRate;
+constexpr int FlangerCore::kControlInterval;
+constexpr int FlangerCore::kBarberpoleTaps;
+constexpr int Wavetable::kSize;
+
+//==============================================================================
+namespace
+{
+    // kCompactStorage: 16-bit codes, 32768 per kCompactFullScale
+    constexpr float compactScale = 32768.0f / FlangerCore::kCompactFullScale;
+
+    inline float loadSample(float sample) noexcept      { return sample; }
+    inline float loadSample(int16_t sample) noexcept    { return (float)sample * (1.0f / compactScale); }
+
+    // Rounds to the nearest code and saturates; written without lrint so that packing loops vectorise
+    inline int16_t packSample(float sample) noexcept
+    {
+        const float scaled = std::min(std::max(sample * compactScale, -32768.0f), 32767.0f);
+        return (int16_t)(scaled + (scaled < 0.0f ? -0.5f : 0.5f));
+    }
+
+    // What depth 1 of a full source adds to each MatrixTarget: seconds, seconds, gains, Hz and periods
+    constexpr float matrixSpans[kNumMatrixTargets] = { 0.01f, 0.005f, 1.0f, 1.0f, 10.0f, 0.5f };
+
+    // The matrix keeps the feedback below 1, like the range of the parameter
+    constexpr float matrixFeedbackLimit = 0.99f;
+
+    // State of the LFO shapes that are not a pure function of the phase
+    struct LfoShapes
+    {
+        const Wavetable* wavetable;
+        float randomFrom, randomTo, randomSlew;
+    };
+
+    // Value of the LFO in the range 0-1 at phase ph (0-1)
+    inline float getLfoValue(int wave, float ph, const LfoShapes& shapes) noexcept
+    {
+        switch (wave)
+        {
+        case kSineWave:
+            return kernels::sineShape(ph);
+
+        case kTrWave:
+            return kernels::triangleShape(ph);
+
+        case kSqWave:
+            return kernels::squareShape(ph);
+
+        case kSawWave:
+            return kernels::sawShape(ph);
+
+        case kRandomWave:
+        {
+            // Glides from the previous value to the new one over the first randomSlew of the period, then holds it
+            const float glide = shapes.randomSlew > 0.0f ? std::min(1.0f, ph / shapes.randomSlew) : 1.0f;
+            return shapes.randomFrom + (shapes.randomTo - shapes.randomFrom) * glide;
+        }
+
+        case kWavetableWave:
+            return shapes.wavetable != nullptr ? shapes.wavetable->getValue(ph) : 0.5f;
+
+        default:
+            return 0.0f;
+        }
+    }
+}
+
+//==============================================================================
+std::unique_ptr<Wavetable> Wavetable::fromPoints(const float* points, int numPoints)
+{
+    std::unique_ptr<Wavetable> table(new Wavetable());
+
+    for (int i = 0; i <= kSize; ++i)
+    {
+        float value = 0.5f;
+
+        if (points != nullptr && numPoints > 0)
+        {
+            // The points cover one period, so the last one interpolates towards the first
+            const float position = (float)(i % kSize) * (float)numPoints / (float)kSize;
+            const int index = (int)position;
+            const float fraction = position - (float)index;
+            const float from = points[index % numPoints];
+            const float to = points[(index + 1) % numPoints];
+
+            value = from + fraction * (to - from);
+        }
+
+        table->values[i] = std::min(std::max(value, 0.0f), 1.0f);
+    }
+
+    return table;
+}
+
+//==============================================================================
+FlangerCore::~FlangerCore()
+{
+    collectGarbage();
+    delete pendingWavetable.exchange(nullptr);
+    delete wavetable;
+}
+
+void FlangerCore::setWavetable(std::unique_ptr<Wavetable> table)
+{
+    collectGarbage();
+
+    // Null stands for the flat line: the audio thread takes a null pending table as "no change"
+    if (table == nullptr)
+        table = Wavetable::fromPoints(nullptr, 0);
+
+    // A table the audio thread has not picked up yet is still ours to delete
+    delete pendingWavetable.exchange(table.release(), std::memory_order_acq_rel);
+}
+
+void FlangerCore::collectGarbage() noexcept
+{
+    delete retiredWavetable.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+void FlangerCore::acquireWavetable() noexcept
+{
+    // Only one table can be waiting to be deleted: until it is, the new one stays pending
+    if (pendingWavetable.load(std::memory_order_relaxed) == nullptr
+        || retiredWavetable.load(std::memory_order_acquire) != nullptr)
+        return;
+
+    if (auto* next = pendingWavetable.exchange(nullptr, std::memory_order_acq_rel))
+    {
+        retiredWavetable.store(wavetable, std::memory_order_release);
+        wavetable = next;
+    }
+}
+
+//==============================================================================
+void FlangerCore::prepare(double newSampleRate, int newNumChannels, int newMaximumBlockSize)
+{
+    sampleRate = newSampleRate;
+    inverseSampleRate = 1.0 / newSampleRate;
+    numChannels = std::max(0, newNumChannels);
+    maximumBlockSize = std::max(1, newMaximumBlockSize);
+
+    // The delay buffer length (in samples) is the number of samples of the maximum delay achievable in the current range
+    delayBufferLength = getDelayLineLength(delayRange, newSampleRate);
+
+    // The pool holds the longest range at kPoolSampleRate, so it only grows for more channels or a higher rate.
+    // It is not zero-filled: the part the longest range needs at this rate is written once, so that a later
+    // range change does not fault its pages in on the audio thread, and the rest is never touched.
+    const size_t poolSize = (size_t)numChannels * (size_t)getDelayLineLength(kDoublerRange, std::max(newSampleRate, kPoolSampleRate));
+
+    if (poolSize > delayPoolSize)
+    {
+        delayPool.reset(new unsigned char[poolSize * sizeof(float)]);
+        delayPoolSize = poolSize;
+        delayPoolTouched = 0;
+    }
+
+    const size_t longestLines = (size_t)numChannels * (size_t)getDelayLineLength(kDoublerRange, newSampleRate);
+
+    if (delayPool != nullptr && longestLines > delayPoolTouched)
+    {
+        std::memset(delayPool.get() + delayPoolTouched * sizeof(float), 0, (longestLines - delayPoolTouched) * sizeof(float));
+        delayPoolTouched = longestLines;
+    }
+
+    // The scratch buffers only grow: a smaller block size keeps them, their contents never outlive a block
+    if ((size_t)maximumBlockSize > delayTimes.size())
+    {
+        delayTimes.assign((size_t)maximumBlockSize, 0.0f);
+        wetBuffer.assign((size_t)maximumBlockSize, 0.0f);
+        fadeBuffer.assign((size_t)maximumBlockSize, 0.0f);
+        midSideBuffer.assign(2 * (size_t)maximumBlockSize, 0.0f);
+        storeBuffer.assign((size_t)maximumBlockSize, 0.0f);
+        barberpoleDelays.assign((size_t)kBarberpoleTaps * (size_t)maximumBlockSize, 0.0f);
+        barberpoleWindows.assign((size_t)kBarberpoleTaps * (size_t)maximumBlockSize, 0.0f);
+        tapBuffer.assign((size_t)maximumBlockSize, 0.0f);
+        tapDelays.assign((size_t)maximumBlockSize, 0.0f);
+        feedbackRamp.assign((size_t)maximumBlockSize, 0.0f);
+        gainRamp.assign((size_t)maximumBlockSize, 0.0f);
+        stereoDelayTimes.assign((size_t)maximumBlockSize, 0.0f);
+    }
+
+    for (auto& cycles : stageCycles)
+        cycles.store(0, std::memory_order_relaxed);
+
+    reset();
+}
+
+void FlangerCore::reset() noexcept
+{
+    clearDelayLines();
+
+    lfoPhase = 0.0f;
+    randomState = 1;
+    randomFrom = 0.5f;
+    randomTo = 0.5f;
+    envelope = 0.0f;
+    sidechainEnvelope = 0.0f;
+    std::fill(matrixValues, matrixValues + kNumMatrixTargets, 0.0f);
+    lfo2Phase = 0.0f;
+    matrixRandomState = 2;
+    matrixRandomFrom = 0.5f;
+    matrixRandomTo = 0.5f;
+    delayBufferWrite = 0;
+    lastReadMode = -1;
+    lastBarberpole = kBarberpoleOff;
+    delayLinesMidSide = false;
+    fadeInWet = false;
+}
+
+//==============================================================================
+void FlangerCore::process(const float* const* input, float* const* output,
+                          int numChannelsToProcess, int numSamples, const Parameters& params,
+                          const float* const* sidechain, int numSidechainChannels) noexcept
+{
+    const int numDelayChannels = delayPool == nullptr ? 0 : std::min(numChannelsToProcess, numChannels);
+
+    acquireWavetable();
+
+    if (params.delayRange != delayRange)
+        setDelayRange(params.delayRange);
+
+    if (params.delayStorage != delayStorage)
+        setDelayStorage(params.delayStorage);
+
+    // The delay lines are only as long as the range needs: keep the delay and the sweep inside them, 4 samples
+    // short of the end for the headroom of the reads and the interpolation
+    const float longestDelay = (float)((double)(delayBufferLength - 4) * inverseSampleRate);
+    Parameters limited = params;
+    limited.sweep = std::min(std::max(params.sweep, 0.0f), kMaximumSweepWidth);
+    limited.delay = std::min(std::max(params.delay, 0.0f), std::max(0.0f, longestDelay - limited.sweep));
+
+    // The LFO tables only take a phase in [0, 1): a speed the phase cannot follow would step it out of that range
+    limited.speed = limitSpeed(params.speed, sampleRate);
+    limited.lfo2Speed = limitSpeed(params.lfo2Speed, sampleRate);
+
+    // Hosts may send more samples than announced in prepare(): split them into blocks the scratch buffers can hold
+    if (numDelayChannels > 0)
+    {
+        for (int startSample = 0; startSample < numSamples; startSample += maximumBlockSize)
+        {
+            SidechainView view;
+
+            if (sidechain != nullptr && numSidechainChannels > 0)
+            {
+                view.left = sidechain[0] + startSample;
+                view.right = numSidechainChannels > 1 ? sidechain[1] + startSample : nullptr;
+            }
+
+            processSubBlock(input, output, startSample, std::min(maximumBlockSize, numSamples - startSample),
+                            numDelayChannels, limited, view);
+        }
+    }
+
+    // Channels without a delay line are passed through untouched
+    for (int channel = numDelayChannels; channel < numChannelsToProcess; ++channel)
+        if (output[channel] != input[channel])
+            std::memcpy(output[channel], input[channel], sizeof(float) * (size_t)numSamples);
+}
+
+void FlangerCore::processBypassed(const float* const* input, float* const* output,
+                                  int numChannelsToProcess, int numSamples, const Parameters& params) noexcept
+{
+    for (int channel = 0; channel < numChannelsToProcess; ++channel)
+        if (output[channel] != input[channel])
+            std::memcpy(output[channel], input[channel], sizeof(float) * (size_t)numSamples);
+
+    const int numDelayChannels = delayPool == nullptr ? 0 : std::min(numChannelsToProcess, numChannels);
+
+    if (numDelayChannels == 0 || numSamples <= 0)
+        return;
+
+    if (params.delayRange != delayRange)
+        setDelayRange(params.delayRange);
+
+    if (params.delayStorage != delayStorage)
+        setDelayStorage(params.delayStorage);
+
+    // Only the last delayBufferLength samples survive in the delay lines: copy them in at most two pieces
+    const int skipped = std::max(0, numSamples - delayBufferLength);
+    const int count = numSamples - skipped;
+    const int write = (int)(((int64_t)delayBufferWrite + skipped) % delayBufferLength);
+    const int firstPiece = std::min(count, delayBufferLength - write);
+
+    for (int channel = 0; channel < numDelayChannels; ++channel)
+    {
+        const float* channelInData = input[channel] + skipped;
+
+        if (delayStorage == kCompactStorage)
+        {
+            writeCompact(getCompactChannel(channel), write, channelInData, count);
+            continue;
+        }
+
+        float* delayData = getDelayChannel(channel);
+
+        std::memcpy(delayData + write, channelInData, sizeof(float) * (size_t)firstPiece);
+        std::memcpy(delayData, channelInData + firstPiece, sizeof(float) * (size_t)(count - firstPiece));
+    }
+
+    delayBufferWrite = (int)(((int64_t)delayBufferWrite + numSamples) % delayBufferLength);
+
+    // The delay lines now hold left and right, whatever the stereo mode
+    delayLinesMidSide = false;
+
+    // The LFO moves on in one step, drawing the random values of the periods it went through
+    const double phase = (double)lfoPhase + (double)limitSpeed(params.speed, sampleRate) * inverseSampleRate * (double)numSamples;
+    const double periods = std::floor(phase);
+    lfoPhase = std::min((float)(phase - periods), std::nextafter(1.0f, 0.0f));
+
+    if (params.wave == kRandomWave)
+    {
+        for (int64_t i = 0; i < (int64_t)periods; ++i)
+        {
+            randomFrom = randomTo;
+            randomTo = nextRandomValue(randomState);
+        }
+    }
+
+    // The first block after the bypass fades in from the dry signal, which covers any change of read mode too
+    lastReadMode = -1;
+    fadeInWet = true;
+}
+
+void FlangerCore::setDelayRange(int range) noexcept
+{
+    // The pool holds the longest range, so this never allocates; what was in the delay lines doesn't fit the new length
+    delayRange = range == kChorusRange || range == kDoublerRange ? range : (int)kFlangeRange;
+    delayBufferLength = getDelayLineLength(delayRange, sampleRate);
+    delayBufferWrite = 0;
+    clearDelayLines();
+    delayLinesMidSide = false;
+    lastReadMode = -1;
+    fadeInWet = true;
+}
+
+void FlangerCore::setDelayStorage(int storage) noexcept
+{
+    const int newStorage = storage == kCompactStorage ? (int)kCompactStorage : (int)kFloatStorage;
+
+    if (newStorage == delayStorage)
+        return;
+
+    delayStorage = newStorage;
+
+    if (delayPool == nullptr)
+        return;
+
+    // The compact samples take the first half of the bytes the float ones did. Packing runs forwards and unpacking
+    // backwards, so every sample is read before its bytes are overwritten; memcpy keeps the two views apart.
+    unsigned char* bytes = delayPool.get();
+    const size_t numSamples = (size_t)numChannels * (size_t)delayBufferLength;
+
+    if (delayStorage == kCompactStorage)
+    {
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            float sample;
+            std::memcpy(&sample, bytes + i * sizeof(float), sizeof(float));
+            const int16_t code = packSample(sample);
+            std::memcpy(bytes + i * sizeof(int16_t), &code, sizeof(int16_t));
+        }
+    }
+    else
+    {
+        for (size_t i = numSamples; i-- > 0;)
+        {
+            int16_t code;
+            std::memcpy(&code, bytes + i * sizeof(int16_t), sizeof(int16_t));
+            const float sample = loadSample(code);
+            std::memcpy(bytes + i * sizeof(float), &sample, sizeof(float));
+        }
+    }
+}
+
+void FlangerCore::writeCompact(int16_t* delayData, int write, const float* source, int count) const noexcept
+{
+    const int firstPiece = std::min(count, delayBufferLength - write);
+
+    for (int i = 0; i < firstPiece; ++i)
+        delayData[write + i] = packSample(source[i]);
+
+    for (int i = firstPiece; i < count; ++i)
+        delayData[i - firstPiece] = packSample(source[i]);
+}
+
+void FlangerCore::processSubBlock(const float* const* input, float* const* output, int startSample,
+                                  int numSamples, int numDelayChannels, const Parameters& params,
+                                  const SidechainView& sidechain) noexcept
+{
+    float minimumDelay;
+
+    // When the read mode or the barberpole mode changes, the taps of the previous one are faded out over this block
+    const int readMode = getReadMode(params);
+    const int barberpole = params.barberpole;
+    const bool crossfade = lastReadMode >= 0 && (lastReadMode != readMode || lastBarberpole != barberpole);
+    const int previousReadMode = lastReadMode;
+    const int previousBarberpole = lastBarberpole;
+    const int matrixTargets = updateMatrixTargets(params, numDelayChannels);
+
+    {
+        FLANGER_TRACE_STAGE(stageCycles, kLfoStage);
+
+        const float startPhase = lfoPhase;
+
+        const float envelopeTarget = isEnvelopeFollowerOn(params)
+                                   ? measureLevel(input, startSample, numSamples, numDelayChannels, params.envelopeDetector)
+                                   : 0.0f;
+
+        minimumDelay = renderDelayTimes(numSamples, params, envelopeTarget, sidechain, matrixTargets);
+
+        // Barberpole taps, also when fading out of the barberpole mode
+        if (barberpole != kBarberpoleOff || (crossfade && previousBarberpole != kBarberpoleOff))
+        {
+            const int direction = barberpole != kBarberpoleOff ? barberpole : previousBarberpole;
+            minimumDelay = std::min(minimumDelay, renderBarberpoleTaps(numSamples, params, direction, startPhase));
+        }
+    }
+
+    // The highest sample read for sample i sits delayTimes[i] + 1 samples behind its write position:
+    // within a chunk no longer than the smallest delay, every read happens before any write it could see.
+    const int chunkSize = std::max(1, (int)minimumDelay);
+
+    const float polarity = params.polarity == 1 ? -1.0f : 1.0f;
+    float* wet = wetBuffer.data();
+    float* fade = fadeBuffer.data();
+    const float fadeStep = 1.0f / (float)numSamples;
+
+    // Mid/side needs a pair of channels. The delay lines follow the mode, so the echoes in them carry on across a switch.
+    const bool midSide = params.stereoMode == kMidSide && numDelayChannels >= 2;
+
+    if (midSide != delayLinesMidSide)
+    {
+        convertDelayLines(midSide);
+        delayLinesMidSide = midSide;
+    }
+
+    float* mid = midSideBuffer.data();
+    float* side = midSideBuffer.data() + maximumBlockSize;
+
+    if (midSide)
+    {
+        // Encode in one pass; the channel loop then flanges mid and side in place
+        const float* left = input[0] + startSample;
+        const float* right = input[1] + startSample;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            mid[i] = 0.5f * (left[i] + right[i]);
+            side[i] = 0.5f * (left[i] - right[i]);
+        }
+    }
+
+    // The matrix ramps replace the constant feedback and gain of the channels, and the delay times of the second one
+    const bool rampGains = (matrixTargets & (1 << kTargetFeedback | 1 << kTargetGain)) != 0;
+    const bool stereoPhase = (matrixTargets & 1 << kTargetStereoPhase) != 0;
+
+    const bool compact = delayStorage == kCompactStorage;
+    float* store = storeBuffer.data();
+    int dpw = delayBufferWrite;
+
+    for (int channel = 0; channel < numDelayChannels; ++channel)
+    {
+        // channelInData and channelOutData can be the same array: each input sample is read before its output is written
+        const float* channelInData = input[channel] + startSample;
+        float* channelOutData = output[channel] + startSample;
+        float* delayData = compact ? nullptr : getDelayChannel(channel);
+        int16_t* compactData = compact ? getCompactChannel(channel) : nullptr;
+        const float* channelDelays = stereoPhase && channel == 1 ? stereoDelayTimes.data() : delayTimes.data();
+        float fbP = params.feedback;
+        float gainP = params.gain;
+
+        if (midSide && channel < 2)
+        {
+            channelOutData = channel == 0 ? mid : side;
+            channelInData = channelOutData;
+
+            if (channel == 1)
+            {
+                fbP = params.sideFeedback;
+                gainP = params.sideGain;
+            }
+        }
+
+        const float wetGain = gainP * polarity;
+
+        // Every channel starts from the same write position
+        dpw = delayBufferWrite;
+
+        for (int chunkStart = 0; chunkStart < numSamples; chunkStart += chunkSize)
+        {
+            const int chunkLength = std::min(chunkSize, numSamples - chunkStart);
+
+            {
+                FLANGER_TRACE_STAGE(stageCycles, kInterpolationStage);
+
+                auto read = [&](int mode, int barberpoleMode, float* destination) noexcept
+                {
+                    if (compact)
+                        readWet(compactData, dpw, channelDelays, chunkStart, chunkLength, mode, barberpoleMode, destination);
+                    else
+                        readWet(delayData, dpw, channelDelays, chunkStart, chunkLength, mode, barberpoleMode, destination);
+                };
+
+                read(readMode, barberpole, wet);
+
+                if (crossfade)
+                {
+                    read(previousReadMode, previousBarberpole, fade);
+
+                    for (int i = 0; i < chunkLength; ++i)
+                        wet[i] = fade[i] + (wet[i] - fade[i]) * ((float)(chunkStart + i + 1) * fadeStep);
+                }
+            }
+
+            FLANGER_TRACE_STAGE(stageCycles, kFeedbackStage);
+
+            // Instantiated once with the constant feedback and gain, and once with the matrix ramps around them
+            auto writeChunk = [&](auto ramped) noexcept
+            {
+                const bool ramps = decltype(ramped)::value;
+                const float* feedbacks = feedbackRamp.data() + chunkStart;
+                const float* gains = gainRamp.data() + chunkStart;
+
+                auto getFeedback = [&](int i) noexcept
+                {
+                    return ramps ? std::min(std::max(fbP + feedbacks[i], 0.0f), matrixFeedbackLimit) : fbP;
+                };
+
+                auto getWetGain = [&](int i) noexcept
+                {
+                    return ramps ? std::min(std::max(gainP + gains[i], 0.0f), 1.0f) * polarity : wetGain;
+                };
+
+                if (compact)
+                {
+                    // The delay line input of the chunk goes through storeBuffer, to be packed in one pass
+                    for (int i = 0; i < chunkLength; ++i)
+                    {
+                        const float in = channelInData[chunkStart + i];
+                        store[i] = in + wet[i] * getFeedback(i);
+                        channelOutData[chunkStart + i] = in + getWetGain(i) * wet[i];
+                    }
+
+                    writeCompact(compactData, dpw, store, chunkLength);
+                    dpw += chunkLength;
+
+                    if (dpw >= delayBufferLength)
+                        dpw -= delayBufferLength;
+                }
+                else
+                {
+                    for (int i = 0; i < chunkLength; ++i)
+                    {
+                        const float in = channelInData[chunkStart + i];
+
+                        // Store the current information in the delay buffer, then move the write pointer at a constant rate
+                        delayData[dpw] = in + wet[i] * getFeedback(i);
+
+                        if (++dpw >= delayBufferLength)
+                            dpw = 0;
+
+                        // Store the output sample, replacing the input when processing in place
+                        channelOutData[chunkStart + i] = in + getWetGain(i) * wet[i];
+                    }
+                }
+
+                // Leaving the bypass: the wet signal fades in over the block
+                if (fadeInWet)
+                    for (int i = 0; i < chunkLength; ++i)
+                        channelOutData[chunkStart + i] -= getWetGain(i) * wet[i] * (1.0f - (float)(chunkStart + i + 1) * fadeStep);
+            };
+
+            if (rampGains)
+                writeChunk(std::true_type());
+            else
+                writeChunk(std::false_type());
+        }
+    }
+
+    if (midSide)
+    {
+        // Decode in one pass
+        float* left = output[0] + startSample;
+        float* right = output[1] + startSample;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            left[i] = mid[i] + side[i];
+            right[i] = mid[i] - side[i];
+        }
+    }
+
+    delayBufferWrite = dpw;
+    fadeInWet = false;
+    lastReadMode = readMode;
+    lastBarberpole = barberpole;
+}
+
+void FlangerCore::convertDelayLines(bool toMidSide) noexcept
+{
+    // Decoding is left = mid + side, right = mid - side; encoding halves the sum and the difference
+    const float scale = toMidSide ? 0.5f : 1.0f;
+
+    if (delayStorage == kCompactStorage)
+    {
+        int16_t* first = getCompactChannel(0);
+        int16_t* second = getCompactChannel(1);
+
+        for (int i = 0; i < delayBufferLength; ++i)
+        {
+            const float a = loadSample(first[i]);
+            const float b = loadSample(second[i]);
+            first[i] = packSample(scale * (a + b));
+            second[i] = packSample(scale * (a - b));
+        }
+
+        return;
+    }
+
+    float* first = getDelayChannel(0);
+    float* second = getDelayChannel(1);
+
+    for (int i = 0; i < delayBufferLength; ++i)
+    {
+        const float a = first[i];
+        const float b = second[i];
+        first[i] = scale * (a + b);
+        second[i] = scale * (a - b);
+    }
+}
+
+template <typename Sample>
+void FlangerCore::readWet(const Sample* delayData, int dpw, const float* times, int chunkStart, int chunkLength,
+                          int readMode, int barberpole, float* wet) noexcept
+{
+    if (barberpole == kBarberpoleOff)
+    {
+        readDelayLine(delayData, dpw, times + chunkStart, wet, chunkLength, readMode);
+        return;
+    }
+
+    std::fill(wet, wet + chunkLength, 0.0f);
+
+    // The taps were rendered for one direction; the other one (only needed to fade out of it) mirrors them
+    const float mirror = 2.0f * barberpoleCentre;
+
+    for (int tap = 0; tap < kBarberpoleTaps; ++tap)
+    {
+        const float* delays = barberpoleDelays.data() + (size_t)tap * (size_t)maximumBlockSize + chunkStart;
+        const float* window = barberpoleWindows.data() + (size_t)tap * (size_t)maximumBlockSize + chunkStart;
+
+        if (barberpole != barberpoleDirection)
+        {
+            for (int i = 0; i < chunkLength; ++i)
+                tapDelays[(size_t)i] = mirror - delays[i];
+
+            delays = tapDelays.data();
+        }
+
+        readDelayLine(delayData, dpw, delays, tapBuffer.data(), chunkLength, readMode);
+
+        for (int i = 0; i < chunkLength; ++i)
+            wet[i] += window[i] * tapBuffer[(size_t)i];
+    }
+}
+
+//==============================================================================
+float FlangerCore::renderDelayTimes(int numSamples, const Parameters& params, float envelopeTarget,
+                                    const SidechainView& sidechain, int matrixTargets) noexcept
+{
+    // The current delay is the base delay plus the instantaneous value of the LFO, whose shape is chosen by the user.
+    // The LFO is shared by all the channels, so it is evaluated once per sample for the whole block.
+    const float delayP = params.delay;
+    const float sweepP = params.sweep;
+    const float samplesPerSecond = (float)sampleRate;
+    float phaseIncrement = (float)(params.speed * inverseSampleRate);
+
+    // The delay and the sweep the LFO moves between: the parameters, unless the matrix ramps them
+    float modulatedDelay = delayP;
+    float modulatedSweep = sweepP;
+
+    float* delays = delayTimes.data();
+    float ph = lfoPhase;
+    float minimumDelay = (float)delayBufferLength;
+
+    // Within a block the envelope only rises towards its target (attack) or only falls (release),
+    // so one smoothing coefficient serves the whole block
+    const bool followEnvelope = isEnvelopeFollowerOn(params);
+    float env = envelope;
+    float envelopeCoefficient = 0.0f;
+
+    if (followEnvelope)
+    {
+        const float envelopeTime = envelopeTarget > env ? params.envelopeAttack : params.envelopeRelease;
+        envelopeCoefficient = 1.0f - std::exp(-1.0f / std::max(1.0f, envelopeTime * samplesPerSecond));
+    }
+
+    const float envelopeToDelay = params.envelopeToDelay;
+    const float envelopeToSweep = params.envelopeToSweep;
+    // The envelope may push the delay past what process() allowed: keep the same 4 samples of headroom for the reads
+    const float maximumDelay = (float)(delayBufferLength - 4);
+
+    // The sidechain envelope follows every sample, so it picks the attack or release coefficient per sample
+    const int source = params.modulationSource;
+    float scEnv = sidechainEnvelope;
+    float sidechainAttack = 0.0f, sidechainRelease = 0.0f;
+
+    if (source == kSidechainEnvelopeSource)
+    {
+        sidechainAttack = 1.0f - std::exp(-1.0f / std::max(1.0f, params.envelopeAttack * samplesPerSecond));
+        sidechainRelease = 1.0f - std::exp(-1.0f / std::max(1.0f, params.envelopeRelease * samplesPerSecond));
+    }
+
+    LfoShapes shapes { wavetable, randomFrom, randomTo, params.randomSlew };
+
+    // Value of the modulation source (0-1) at sample i of the block, the LFO being at phase
+    auto getModulation = [&](int i, float phase) noexcept
+    {
+        switch (source)
+        {
+        case kSidechainSource:
+            return 0.5f + 0.5f * std::min(std::max(sidechain.getSample(i), -1.0f), 1.0f);
+
+        case kSidechainEnvelopeSource:
+            return std::min(scEnv, 1.0f);
+
+        case kLfoSource:
+        default:
+            return getLfoValue(params.wave, phase, shapes);
+        }
+    };
+
+    auto getDelay = [&](float lfo) noexcept
+    {
+        if (! followEnvelope)
+            return (modulatedDelay + modulatedSweep * lfo) * samplesPerSecond;
+
+        // The envelope can push the delay out of the buffer: keep it inside
+        const float currentDelay = modulatedDelay + envelopeToDelay * env + modulatedSweep * (1.0f - envelopeToSweep * (1.0f - env)) * lfo;
+        return std::min(std::max(currentDelay * samplesPerSecond, 0.0f), maximumDelay);
+    };
+
+    // Update the LFO phase, normalizing its value in the range 0-1, and the envelopes with sample i
+    auto advance = [&](int i) noexcept
+    {
+        ph += phaseIncrement;
+
+        if (ph >= 1.0f)
+        {
+            ph -= std::floor(ph);
+
+            // A new period holds a new random value
+            if (params.wave == kRandomWave)
+            {
+                shapes.randomFrom = shapes.randomTo;
+                shapes.randomTo = nextRandomValue(randomState);
+            }
+        }
+
+        if (followEnvelope)
+            env += envelopeCoefficient * (envelopeTarget - env);
+
+        if (source == kSidechainEnvelopeSource)
+        {
+            const float level = std::abs(sidechain.getSample(i));
+            scEnv += (level > scEnv ? sidechainAttack : sidechainRelease) * (level - scEnv);
+        }
+    };
+
+    if (matrixTargets != 0)
+    {
+        // The matrix is evaluated at the start of every kControlInterval samples, and each target ramps linearly
+        // from the value of the previous evaluation to the new one over them; the LFO speed steps to its new value
+        const bool eco = params.quality == kEcoQuality;
+        const bool stereoPhase = (matrixTargets & 1 << kTargetStereoPhase) != 0;
+        const float longestDelay = (float)(delayBufferLength - 4);
+        const float lastPhase = std::nextafter(1.0f, 0.0f);
+        const float lfo2Increment = (float)(params.lfo2Speed * inverseSampleRate);
+        float* stereoDelays = stereoDelayTimes.data();
+        float* feedbacks = feedbackRamp.data();
+        float* gains = gainRamp.data();
+
+        // The delay and the sweep with the matrix offsets; the delay then stays inside the buffer with the headroom
+        // of process()
+        auto setOffsets = [&](float delayOffset, float sweepOffset) noexcept
+        {
+            modulatedDelay = delayP + delayOffset;
+            modulatedSweep = std::min(std::max(sweepP + sweepOffset, 0.0f), kMaximumSweepWidth);
+        };
+
+        auto limit = [&](float delay) noexcept { return std::min(std::max(delay, 0.0f), longestDelay); };
+
+        // Delay of the second channel, whose LFO runs ahead by the stereo phase (in periods)
+        auto getStereoDelay = [&](float phaseOffset) noexcept
+        {
+            float phase = ph + phaseOffset;
+            phase -= std::floor(phase);
+            return limit(getDelay(getLfoValue(params.wave, std::min(phase, lastPhase), shapes)));
+        };
+
+        float startDelay = 0.0f, startStereoDelay = 0.0f;
+
+        if (eco)
+        {
+            setOffsets(matrixValues[kTargetDelay], matrixValues[kTargetSweep]);
+            startDelay = limit(getDelay(getModulation(0, ph)));
+            startStereoDelay = stereoPhase ? getStereoDelay(matrixValues[kTargetStereoPhase]) : startDelay;
+            minimumDelay = std::min(minimumDelay, std::min(startDelay, startStereoDelay));
+        }
+
+        for (int start = 0; start < numSamples; start += kControlInterval)
+        {
+            const int length = std::min(kControlInterval, numSamples - start);
+
+            float targets[kNumMatrixTargets];
+            evaluateMatrix(params, getLfoValue(params.wave, ph, shapes), env, targets);
+
+            float steps[kNumMatrixTargets];
+
+            for (int target = 0; target < kNumMatrixTargets; ++target)
+                steps[target] = (targets[target] - matrixValues[target]) / (float)length;
+
+            phaseIncrement = (float)(limitSpeed(params.speed + targets[kTargetSpeed], sampleRate) * inverseSampleRate);
+
+            // Sample i of the chunk is (i + 1) / length of the way, so the ramps reach the targets at its end
+            for (int i = 0; i < length; ++i)
+            {
+                const float position = (float)(i + 1);
+                feedbacks[start + i] = matrixValues[kTargetFeedback] + steps[kTargetFeedback] * position;
+                gains[start + i] = matrixValues[kTargetGain] + steps[kTargetGain] * position;
+
+                if (! eco)
+                {
+                    setOffsets(matrixValues[kTargetDelay] + steps[kTargetDelay] * position,
+                               matrixValues[kTargetSweep] + steps[kTargetSweep] * position);
+
+                    delays[start + i] = limit(getDelay(getModulation(start + i, ph)));
+                    minimumDelay = std::min(minimumDelay, delays[start + i]);
+
+                    if (stereoPhase)
+                    {
+                        stereoDelays[start + i] = getStereoDelay(matrixValues[kTargetStereoPhase] + steps[kTargetStereoPhase] * position);
+                        minimumDelay = std::min(minimumDelay, stereoDelays[start + i]);
+                    }
+                }
+
+                advance(start + i);
+            }
+
+            if (eco)
+            {
+                // Control rate, like the unmodulated kEcoQuality: the delays ramp between the ends of the chunk
+                setOffsets(targets[kTargetDelay], targets[kTargetSweep]);
+
+                const float endDelay = limit(getDelay(getModulation(start + length - 1, ph)));
+                const float step = (endDelay - startDelay) / (float)length;
+
+                for (int i = 0; i < length; ++i)
+                    delays[start + i] = startDelay + step * (float)i;
+
+                minimumDelay = std::min(minimumDelay, endDelay);
+                startDelay = endDelay;
+
+                if (stereoPhase)
+                {
+                    const float endStereoDelay = getStereoDelay(targets[kTargetStereoPhase]);
+                    const float stereoStep = (endStereoDelay - startStereoDelay) / (float)length;
+
+                    for (int i = 0; i < length; ++i)
+                        stereoDelays[start + i] = startStereoDelay + stereoStep * (float)i;
+
+                    minimumDelay = std::min(minimumDelay, endStereoDelay);
+                    startStereoDelay = endStereoDelay;
+                }
+            }
+
+            std::copy(targets, targets + kNumMatrixTargets, matrixValues);
+
+            // The second LFO moves on by the chunk; a new period holds a new random value
+            lfo2Phase += lfo2Increment * (float)length;
+
+            if (lfo2Phase >= 1.0f)
+            {
+                lfo2Phase = std::min(lfo2Phase - std::floor(lfo2Phase), lastPhase);
+                matrixRandomFrom = matrixRandomTo;
+                matrixRandomTo = nextRandomValue(matrixRandomState);
+            }
+        }
+    }
+    else if (params.quality == kEcoQuality)
+    {
+        // Control rate: the LFO is evaluated at the start and end of every kControlInterval samples,
+        // and the delay ramps linearly in between
+        float startDelay = getDelay(getModulation(0, ph));
+        minimumDelay = std::min(minimumDelay, startDelay);
+
+        for (int start = 0; start < numSamples; start += kControlInterval)
+        {
+            const int length = std::min(kControlInterval, numSamples - start);
+
+            // The phase still advances sample by sample, so that it rounds exactly like in kHighQuality
+            for (int i = 0; i < length; ++i)
+                advance(start + i);
+
+            const float endDelay = getDelay(getModulation(start + length - 1, ph));
+            const float step = (endDelay - startDelay) / (float)length;
+
+            for (int i = 0; i < length; ++i)
+                delays[start + i] = startDelay + step * (float)i;
+
+            minimumDelay = std::min(minimumDelay, endDelay);
+            startDelay = endDelay;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            delays[i] = getDelay(getModulation(i, ph));
+            minimumDelay = std::min(minimumDelay, delays[i]);
+            advance(i);
+        }
+    }
+
+    lfoPhase = ph;
+    randomFrom = shapes.randomFrom;
+    randomTo = shapes.randomTo;
+    envelope = env;
+    sidechainEnvelope = scEnv;
+    return minimumDelay;
+}
+
+int FlangerCore::updateMatrixTargets(const Parameters& params, int numDelayChannels) noexcept
+{
+    int targets = 0;
+
+    for (const auto& slot : params.modulation)
+        if (slot.isActive())
+            targets |= 1 << slot.target;
+
+    // A target no slot drives any more ramps back to 0 over one control interval before it stops being rendered
+    for (int target = 0; target < kNumMatrixTargets; ++target)
+        if (matrixValues[target] != 0.0f)
+            targets |= 1 << target;
+
+    // The barberpole taps run at the speed of the parameter, and ramp rather than follow the LFO shape
+    if (params.barberpole != kBarberpoleOff)
+    {
+        targets &= ~(1 << kTargetSpeed);
+        matrixValues[kTargetSpeed] = 0.0f;
+    }
+
+    // The stereo phase needs a second channel swept by the LFO with a shape that is a function of the phase
+    const bool periodicLfo = params.modulationSource == kLfoSource && params.wave != kRandomWave && params.barberpole == kBarberpoleOff;
+
+    if (numDelayChannels < 2 || ! periodicLfo)
+    {
+        targets &= ~(1 << kTargetStereoPhase);
+        matrixValues[kTargetStereoPhase] = 0.0f;
+    }
+
+    return targets;
+}
+
+void FlangerCore::evaluateMatrix(const Parameters& params, float lfo, float env, float* targets) const noexcept
+{
+    // The random source glides and holds over the periods of the second LFO, like kRandomWave over those of the LFO
+    const int lfo2Wave = params.lfo2Wave >= kSineWave && params.lfo2Wave <= kSawWave ? params.lfo2Wave : (int)kSineWave;
+    const LfoShapes matrixShapes { nullptr, matrixRandomFrom, matrixRandomTo, params.randomSlew };
+
+    float sources[kNumMatrixSources];
+    sources[kMatrixOff] = 0.0f;
+    sources[kMatrixLfo] = lfo;
+    sources[kMatrixLfo2] = getLfoValue(lfo2Wave, lfo2Phase, matrixShapes);
+    sources[kMatrixEnvelope] = std::min(env, 1.0f);
+    sources[kMatrixMidiCc] = std::min(std::max(params.midiCc, 0.0f), 1.0f);
+    sources[kMatrixRandom] = getLfoValue(kRandomWave, lfo2Phase, matrixShapes);
+
+    std::fill(targets, targets + kNumMatrixTargets, 0.0f);
+
+    for (const auto& slot : params.modulation)
+        if (slot.isActive())
+            targets[slot.target] += std::min(std::max(slot.depth, -1.0f), 1.0f) * sources[slot.source] * matrixSpans[slot.target];
+}
+
+float FlangerCore::renderBarberpoleTaps(int numSamples, const Parameters& params, int direction, float startPhase) noexcept
+{
+    // One pass per tap over the whole block, without any loop-carried state: the phase of sample i is computed
+    // directly from the start phase, and each tap is offset by 1 / kBarberpoleTaps of the ramp
+    const float samplesPerSecond = (float)sampleRate;
+    const float phaseIncrement = (float)(params.speed * inverseSampleRate);
+    const float baseDelay = params.delay * samplesPerSecond;
+    const float sweep = params.sweep * samplesPerSecond;
+
+    // Rising notches need a shrinking delay
+    const float rampStart = direction == kBarberpoleRising ? baseDelay + sweep : baseDelay;
+    const float rampSlope = direction == kBarberpoleRising ? -sweep : sweep;
+
+    // sin^2 windows of evenly spread taps sum to kBarberpoleTaps / 2
+    const float windowGain = 2.0f / (float)kBarberpoleTaps;
+
+    for (int tap = 0; tap < kBarberpoleTaps; ++tap)
+    {
+        float* delays = barberpoleDelays.data() + (size_t)tap * (size_t)maximumBlockSize;
+        float* windows = barberpoleWindows.data() + (size_t)tap * (size_t)maximumBlockSize;
+        const float tapPhase = startPhase + (float)tap / (float)kBarberpoleTaps;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float phase = tapPhase + phaseIncrement * (float)i;
+            phase -= (float)(int)phase;
+
+            delays[i] = rampStart + rampSlope * phase;
+
+            // sin^2(pi * phase) = 0.5 - 0.5 * cos(2 * pi * phase), zero where the ramp jumps back
+            const float cosinePhase = phase + 0.25f;
+            windows[i] = windowGain * (0.5f - 0.5f * tables::sine(cosinePhase >= 1.0f ? cosinePhase - 1.0f : cosinePhase));
+        }
+    }
+
+    barberpoleDirection = direction;
+    barberpoleCentre = baseDelay + 0.5f * sweep;
+
+    return baseDelay;
+}
+
+float FlangerCore::measureLevel(const float* const* input, int startSample, int numSamples,
+                                int numChannelsToMeasure, int detector) noexcept
+{
+    // Four independent accumulators, which compilers turn into one SIMD register without -ffast-math
+    float accumulators[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    const int numVectorSamples = numSamples & ~3;
+
+    for (int channel = 0; channel < numChannelsToMeasure; ++channel)
+    {
+        const float* data = input[channel] + startSample;
+
+        if (detector == kRmsDetector)
+        {
+            for (int i = 0; i < numVectorSamples; i += 4)
+                for (int lane = 0; lane < 4; ++lane)
+                    accumulators[lane] += data[i + lane] * data[i + lane];
+
+            for (int i = numVectorSamples; i < numSamples; ++i)
+                accumulators[0] += data[i] * data[i];
+        }
+        else
+        {
+            for (int i = 0; i < numVectorSamples; i += 4)
+                for (int lane = 0; lane < 4; ++lane)
+                    accumulators[lane] = std::max(accumulators[lane], std::abs(data[i + lane]));
+
+            for (int i = numVectorSamples; i < numSamples; ++i)
+                accumulators[0] = std::max(accumulators[0], std::abs(data[i]));
+        }
+    }
+
+    if (detector == kRmsDetector)
+    {
+        const int count = numSamples * numChannelsToMeasure;
+        const float sum = (accumulators[0] + accumulators[1]) + (accumulators[2] + accumulators[3]);
+        return count > 0 ? std::sqrt(sum / (float)count) : 0.0f;
+    }
+
+    return std::max(std::max(accumulators[0], accumulators[1]), std::max(accumulators[2], accumulators[3]));
+}
+
+template <typename Sample>
+void FlangerCore::readDelayLine(const Sample* delayData, int dpw, const float* delays, float* wet,
+                                int numSamples, int readMode) const noexcept
+{
+    const float length = (float)delayBufferLength;
+
+    // Read position of sample i with respect to the write pointer (with 3 samples of headroom), wrapped into the buffer
+    auto readPosition = [&](int i) noexcept
+    {
+        int writePosition = dpw + i;
+
+        if (writePosition >= delayBufferLength)
+            writePosition -= delayBufferLength;
+
+        float dpr = fmodf((float)writePosition - delays[i] + length - 3, length);
+
+        if (dpr < 0)
+            dpr += length;
+
+        return dpr;
+    };
+
+    // The read position is fractional, so the delayed sample is interpolated, see FlangerKernels.h
+    switch (readMode)
+    {
+    case kEcoRead:
+    {
+        // Delays never exceed the buffer length, so two conditional wraps replace the fmodf of readPosition(),
+        // and the write position advances without a modulo
+        int writePosition = dpw;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float dpr = (float)writePosition - delays[i] - 3.0f;
+
+            if (dpr < 0.0f)
+                dpr += length;
+
+            if (dpr < 0.0f)
+                dpr += length;
+
+            // Adding the length to a tiny negative position can round up to the length itself
+            if (dpr >= length)
+                dpr -= length;
+
+            const int sample1 = (int)dpr;
+            const float fraction = dpr - (float)sample1;
+            const int sample2 = sample1 + 1 < delayBufferLength ? sample1 + 1 : 0;
+
+            wet[i] = loadSample(delayData[sample1]) + fraction * (loadSample(delayData[sample2]) - loadSample(delayData[sample1]));
+
+            if (++writePosition >= delayBufferLength)
+                writePosition = 0;
+        }
+        break;
+    }
+
+    case kQuadratic:
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float dpr = readPosition(i);
+            const int sample1 = (int)dpr;
+            const float fraction = dpr - (float)sample1;
+
+            const int sample2 = (sample1 + 1) % delayBufferLength;
+            const int sample0 = (sample1 - 1 + delayBufferLength) % delayBufferLength;
+
+            wet[i] = kernels::interpolateQuadratic(fraction, loadSample(delayData[sample0]),
+                                                   loadSample(delayData[sample1]), loadSample(delayData[sample2]));
+        }
+        break;
+
+    case kCubic:
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float dpr = readPosition(i);
+            const int sample1 = (int)dpr;
+            const float fraction = dpr - (float)sample1;
+
+            const int sample2 = (sample1 + 1) % delayBufferLength;
+            const int sample3 = (sample2 + 1) % delayBufferLength;
+            const int sample0 = (sample1 - 1 + delayBufferLength) % delayBufferLength;
+
+            wet[i] = kernels::interpolateCubic(fraction, loadSample(delayData[sample0]), loadSample(delayData[sample1]),
+                                               loadSample(delayData[sample2]), loadSample(delayData[sample3]));
+        }
+        break;
+
+    case kLinear:
+    default:
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float dpr = readPosition(i);
+            const int sample1 = (int)dpr;
+            const float fraction = dpr - (float)sample1;
+
+            const int nextSample = (sample1 + 1) % delayBufferLength;
+            wet[i] = kernels::interpolateLinear(fraction, loadSample(delayData[sample1]), loadSample(delayData[nextSample]));
+        }
+        break;
+    }
+}
+
+} // namespace flanger
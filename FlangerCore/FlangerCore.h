@@ -0,0 +1,558 @@
+/*
+  ==============================================================================
+
+    FlangerCore.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    The flanger DSP, free of any JUCE dependency. The plugin, the C API and
+    any offline tool all drive this same class.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "FlangerProfiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace flanger
+{
+
+//==============================================================================
+// LFO waveforms, in the same order as the "WAVE" choice parameter of the plugin
+enum Waves
+{
+    kSineWave = 0,
+    kTrWave = 1,
+    kSqWave = 2,
+    kSawWave = 3,
+    kRandomWave = 4,        // sample and hold, a new random value every period, with slew
+    kWavetableWave = 5      // user-drawn shape, see FlangerCore::setWavetable()
+};
+
+// Fractional delay interpolators, in the same order as the "INTERPOL" parameter
+enum Interpol
+{
+    kLinear = 0,
+    kQuadratic = 1,
+    kCubic = 2
+};
+
+// Processing quality, in the same order as the "QUALITY" parameter
+enum Quality
+{
+    kHighQuality = 0,   // LFO and read position computed for every sample, interpolator chosen by Parameters::interpol
+    kEcoQuality = 1     // LFO evaluated every kControlInterval samples and ramped in between, linear taps only
+};
+
+// What sweeps the delay, in the same order as the "MOD_SOURCE" parameter
+enum ModulationSource
+{
+    kLfoSource = 0,                 // the internal LFO
+    kSidechainSource = 1,           // the sidechain signal itself, at audio rate: -1..1 sweeps like the LFO's 0..1
+    kSidechainEnvelopeSource = 2    // the envelope of the sidechain, per sample, with the envelope attack and release
+};
+
+// Barberpole mode, in the same order as the "BARBERPOLE" parameter
+enum Barberpole
+{
+    kBarberpoleOff = 0,
+    kBarberpoleRising = 1,      // the notches sweep up forever
+    kBarberpoleFalling = 2      // the notches sweep down forever
+};
+
+// Longest base delay, in the same order as the "RANGE" parameter; see FlangerCore::getMaximumDelay()
+enum DelayRange
+{
+    kFlangeRange = 0,   // 20 ms
+    kChorusRange = 1,   // 50 ms
+    kDoublerRange = 2   // 100 ms
+};
+
+// Sample format of the delay lines, in the same order as the "STORAGE" parameter
+enum DelayStorage
+{
+    kFloatStorage = 0,
+    kCompactStorage = 1     // 16-bit fixed point up to FlangerCore::kCompactFullScale: half the memory and cache footprint
+};
+
+// What the first two channels flange, in the same order as the "MID_SIDE" parameter
+enum StereoMode
+{
+    kLeftRight = 0,
+    kMidSide = 1    // mid and side, encoded before the delay lines and decoded after them
+};
+
+// Level detector of the envelope follower, in the same order as the "ENV_MODE" parameter
+enum EnvelopeDetector
+{
+    kPeakDetector = 0,
+    kRmsDetector = 1
+};
+
+// Sources of the modulation matrix, in the same order as the "MODn_SOURCE" parameters; all of them are 0-1
+enum MatrixSource
+{
+    kMatrixOff = 0,
+    kMatrixLfo = 1,         // the LFO that sweeps the delay
+    kMatrixLfo2 = 2,        // the second LFO, with its own speed and shape (kSineWave to kSawWave)
+    kMatrixEnvelope = 3,    // the envelope follower, with the envelope attack, release and detector
+    kMatrixMidiCc = 4,      // Parameters::midiCc
+    kMatrixRandom = 5,      // a new random value every period of the second LFO, with the random slew
+    kNumMatrixSources
+};
+
+// Targets of the modulation matrix, in the same order as the "MODn_TARGET" parameters.
+// A slot adds depth * source * the span of its target, the sum being kept within the range of the target.
+enum MatrixTarget
+{
+    kTargetDelay = 0,       // span 10 ms, added to the base delay
+    kTargetSweep = 1,       // span 5 ms, added to the sweep width
+    kTargetFeedback = 2,    // span 1, feedback kept within 0-0.99
+    kTargetGain = 3,        // span 1, gain kept within 0-1
+    kTargetSpeed = 4,       // span 10 Hz, added to the LFO speed
+    kTargetStereoPhase = 5, // span half a period, between the LFO of the first channel and the one of the second
+    kNumMatrixTargets
+};
+
+constexpr int kNumModulationSlots = 4;
+
+// One route of the modulation matrix. A slot is inactive, and costs nothing, while its source is off or its depth 0.
+struct ModulationSlot
+{
+    int source = kMatrixOff;
+    int target = kTargetDelay;
+    float depth = 0.0f;     // -1..1
+
+    bool isActive() const noexcept
+    {
+        return source > kMatrixOff && source < kNumMatrixSources && target >= 0 && target < kNumMatrixTargets && depth != 0.0f;
+    }
+};
+
+//==============================================================================
+/**
+    Flanger settings for one call to FlangerCore::process().
+    Times are in seconds, gains are linear.
+*/
+struct Parameters
+{
+    float delay = 0.015f;   // base delay
+    float sweep = 0.005f;   // LFO sweep width, added on top of the base delay
+    float feedback = 0.5f;  // amount of the delayed signal fed back into the delay line
+    float gain = 1.0f;      // feedforward gain of the delayed signal
+    float speed = 1.0f;     // LFO frequency in Hz
+    int wave = kSineWave;
+    int interpol = kLinear;
+    int polarity = 0;       // 0: wet signal added in phase, 1: wet signal inverted
+    float randomSlew = 0.5f;    // kRandomWave: fraction of each period spent gliding to the new value
+    int quality = kHighQuality;
+    int modulationSource = kLfoSource;  // the sidechain sources need the sidechain passed to process()
+    int barberpole = kBarberpoleOff;    // replaces the LFO by kBarberpoleTaps ramps at the LFO speed
+    int delayRange = kFlangeRange;      // sizes the delay lines, which limit delay + sweep; changing it clears them
+    int delayStorage = kFloatStorage;   // changing it converts the delay lines in place
+
+    // kMidSide: the mid component uses gain and feedback, the side component these two.
+    // A gain and feedback of 0 leave a component dry, to flange only the other one.
+    int stereoMode = kLeftRight;
+    float sideGain = 1.0f;
+    float sideFeedback = 0.5f;
+
+    // Envelope follower on the input (auto-flange), off while both depths are 0.
+    // The delay becomes delay + envelopeToDelay * env, and the sweep sweep * (1 - envelopeToSweep * (1 - env)):
+    // envelopeToSweep = 1 lets the LFO sweep only as deep as the input is loud.
+    float envelopeToDelay = 0.0f;   // seconds added to the delay at full envelope, may be negative
+    float envelopeToSweep = 0.0f;   // 0-1
+    float envelopeAttack = 0.01f;   // seconds
+    float envelopeRelease = 0.2f;   // seconds
+    int envelopeDetector = kPeakDetector;
+
+    // Modulation matrix, on top of the LFO that always sweeps the delay. The slots are evaluated every
+    // FlangerCore::kControlInterval samples, and their targets ramp linearly in between.
+    ModulationSlot modulation[kNumModulationSlots];
+    float lfo2Speed = 0.5f;     // Hz
+    int lfo2Wave = kSineWave;   // kSineWave to kSawWave
+    float midiCc = 0.0f;        // value of kMatrixMidiCc, 0-1
+};
+
+//==============================================================================
+/**
+    A user-drawn LFO shape: one period of values in the range 0-1, plus a guard
+    point. Built off the audio thread and handed to FlangerCore::setWavetable().
+*/
+struct Wavetable
+{
+    static constexpr int kSize = 256;
+
+    float values[kSize + 1];
+
+    // Resamples numPoints evenly spaced points covering one period; values are clamped to 0-1
+    static std::unique_ptr<Wavetable> fromPoints(const float* points, int numPoints);
+
+    // Value at phase (0-1, other phases wrap into it), linearly interpolated
+    float getValue(float phase) const noexcept
+    {
+        const float position = (phase - std::floor(phase)) * (float)kSize;
+
+        // A phase just below a whole number of periods wraps to exactly 1 after rounding: keep it on the last segment
+        const int index = std::min((int)position, kSize - 1);
+        const float fraction = position - (float)index;
+
+        return values[index] + fraction * (values[index + 1] - values[index]);
+    }
+};
+
+//==============================================================================
+/**
+    A modulated delay line with feedback, one circular buffer per channel and
+    a single LFO shared by all channels.
+
+    Lifecycle: prepare() once the sample rate and channel count are known,
+    then process() for every block, and reset() to clear the delay lines and
+    the LFO without reallocating. Only prepare() allocates, and only when it
+    needs more than any earlier call: re-preparing at the same or a lower
+    rate, channel count and block size re-derives the lengths and clears the
+    delay lines in use, like reset().
+
+    Each block goes through three stages: the LFO renders the delay time of
+    every sample once for all channels, then each channel reads the delay line
+    (interpolation) and writes it back with the input (feedback), in chunks
+    short enough that no read can see a sample written in the same chunk.
+
+    In barberpole mode, kBarberpoleTaps taps read the same delay line, each
+    sweeping from one end of the sweep to the other and starting over, one
+    after the other. Their sin^2 windows sum to a constant and are zero at the
+    jump, which gives an endless rising or falling flange.
+
+    The wavetable of kWavetableWave reaches the audio thread through an atomic
+    exchange at the start of process(), and the table it replaces is handed
+    back to be deleted by collectGarbage(), so process() never frees memory.
+
+    In kMidSide mode the first two channels are encoded to mid and side in one
+    pass over the block, flanged as two channels with their own gain and
+    feedback, and decoded in another pass. Switching the mode converts the
+    delay lines, so the echoes already in them carry on.
+
+    The delay lines live in a pool allocated by prepare() for the longest range
+    at kPoolSampleRate (or the prepared rate, if higher), so later calls to
+    prepare() at another rate and range changes in process() never allocate.
+    prepare() writes the part the longest range needs at its rate once; the
+    rest of the pool is never written, so it stays virtual memory on
+    allocators that map large blocks lazily. A range change clears the delay lines in use and
+    fades the wet signal in over one block.
+
+    In kCompactStorage the delay lines hold 16-bit samples in the same pool.
+    Each chunk is written back with one packing pass, and the reads convert
+    the samples they interpolate. Switching the storage converts the delay
+    lines in place.
+
+    Switching the interpolator, the quality or the barberpole mode crossfades
+    the old and the new taps over one block, so they can be automated without
+    clicks.
+
+    The envelope follower measures the peak or RMS of each sub-block over all
+    channels, and the envelope moves towards it sample by sample with the
+    attack and release times. It costs nothing while its depths are 0 and no
+    slot of the modulation matrix reads it.
+
+    The modulation matrix is evaluated with the LFO, once every
+    kControlInterval samples: the sum of the slots on each target becomes the
+    end point of a linear ramp from the previous one, and the ramps go into
+    the same per-sample buffers as the delay times, so the channel loop reads
+    the feedback and the gain from them too. A target left by its last slot
+    ramps back to 0 before the matrix stops costing anything. The stereo
+    phase renders a second row of delay times for the second channel, only
+    while the internal LFO with a periodic shape sweeps the delay; the
+    barberpole taps follow the parameters alone.
+*/
+class FlangerCore
+{
+public:
+    // Maximum base delay of kFlangeRange and maximum sweep width in seconds: together they size the delay buffer
+    static constexpr float kMaximumDelay = 0.02f;
+    static constexpr float kMaximumSweepWidth = 0.02f;
+
+    // Maximum base delay of the longest range, which sizes the delay pool with the sweep width
+    static constexpr float kLongestDelay = 0.1f;
+
+    // The delay pool holds the longest range at this sample rate, so preparing at a rate up to it reuses the pool
+    static constexpr double kPoolSampleRate = 192000.0;
+
+    // kCompactStorage saturates at this level; its step is kCompactFullScale / 32768, about -78 dB below 1
+    static constexpr float kCompactFullScale = 4.0f;
+
+    // Samples between two evaluations of the LFO in kEcoQuality
+    static constexpr int kControlInterval = 16;
+
+    // Taps of the barberpole mode, evenly spread over the ramp
+    static constexpr int kBarberpoleTaps = 3;
+
+    FlangerCore() = default;
+    ~FlangerCore();
+
+    // Maximum base delay of a DelayRange in seconds
+    static float getMaximumDelay(int range) noexcept
+    {
+        return range == kDoublerRange ? kLongestDelay : (range == kChorusRange ? 0.05f : kMaximumDelay);
+    }
+
+    // Samples per channel the delay lines of a range need at a sample rate
+    static int getDelayLineLength(int range, double rate) noexcept
+    {
+        return std::max(1, (int)((getMaximumDelay(range) + kMaximumSweepWidth) * rate));
+    }
+
+    // An LFO speed whose phase advances by at most half a period per sample: 0 to half the sample rate, 0 for NaN
+    static float limitSpeed(float speed, double rate) noexcept
+    {
+        return speed > 0.0f ? std::min(speed, (float)(0.5 * rate)) : 0.0f;
+    }
+
+    void prepare(double newSampleRate, int newNumChannels, int maximumBlockSize);
+    void reset() noexcept;
+
+    /** Processes numSamples samples of each channel. Input and output may point to
+        the same memory. Channels beyond the prepared count are passed through.
+
+        sidechain points to numSidechainChannels channels of numSamples samples that
+        the sidechain modulation sources read in place (the first two are averaged).
+        Without a sidechain, they behave as if it were silent. */
+    void process(const float* const* input, float* const* output,
+                 int numChannelsToProcess, int numSamples, const Parameters& params,
+                 const float* const* sidechain = nullptr, int numSidechainChannels = 0) noexcept;
+
+    /** Bypass: passes the input through, and keeps writing it into the delay lines (without
+        feedback) and moving the LFO on, for a small fraction of the cost of process(). The
+        next process() call then starts from a primed delay line in step with the LFO, and
+        fades the wet signal in over its first block. */
+    void processBypassed(const float* const* input, float* const* output,
+                         int numChannelsToProcess, int numSamples, const Parameters& params) noexcept;
+
+    /** Hands a new kWavetableWave shape to the audio thread, which picks it up at its next
+        process() call. Call from one thread at a time, never from the audio thread. A null
+        table switches kWavetableWave back to a flat line. */
+    void setWavetable(std::unique_ptr<Wavetable> table);
+
+    /** Deletes the tables the audio thread has stopped using. Call it regularly from the
+        thread that calls setWavetable(); setWavetable() calls it too. */
+    void collectGarbage() noexcept;
+
+    double getSampleRate() const noexcept { return sampleRate; }
+    int getNumChannels() const noexcept { return numChannels; }
+    int getDelayBufferLength() const noexcept { return delayBufferLength; }
+    int getDelayRange() const noexcept { return delayRange; }
+    int getDelayStorage() const noexcept { return delayStorage; }
+
+    // LFO phase (0-1) after the last block; read it from the thread that calls process()
+    float getLfoPhase() const noexcept { return lfoPhase; }
+
+    // Bytes of the delay lines of the current range and storage, the part of the pool the audio thread touches
+    size_t getActiveDelayBytes() const noexcept
+    {
+        return (size_t)numChannels * (size_t)delayBufferLength * (delayStorage == kCompactStorage ? sizeof(int16_t) : sizeof(float));
+    }
+
+    // Heap memory owned by the delay pool and the block scratch buffers, the only per-instance allocations of the core
+    size_t getDelayBufferBytes() const noexcept
+    {
+        return (delayPoolSize + delayTimes.capacity() + wetBuffer.capacity() + fadeBuffer.capacity() + midSideBuffer.capacity() + storeBuffer.capacity()
+                + barberpoleDelays.capacity() + barberpoleWindows.capacity() + tapBuffer.capacity() + tapDelays.capacity()
+                + feedbackRamp.capacity() + gainRamp.capacity() + stereoDelayTimes.capacity()) * sizeof(float);
+    }
+
+    // Cycles spent in each stage since prepare(), always 0 unless built with FLANGER_TRACE_STAGES=1
+    uint64_t getStageCycles(int stage) const noexcept
+    {
+        return stage >= 0 && stage < kNumStages ? stageCycles[stage].load(std::memory_order_relaxed) : 0;
+    }
+
+private:
+    // How the delay line is read: one of the Interpol values, or kEcoRead for the control-rate linear taps
+    enum { kEcoRead = 3 };
+
+    static int getReadMode(const Parameters& params) noexcept
+    {
+        return params.quality == kEcoQuality ? (int)kEcoRead : params.interpol;
+    }
+
+    // kFloatStorage: the delay lines are float samples back to back at the start of the pool
+    float* getDelayChannel(int channel) noexcept
+    {
+        return reinterpret_cast<float*>(delayPool.get()) + (size_t)channel * (size_t)delayBufferLength;
+    }
+
+    // kCompactStorage: the delay lines are 16-bit samples back to back at the start of the pool
+    int16_t* getCompactChannel(int channel) noexcept
+    {
+        return reinterpret_cast<int16_t*>(delayPool.get()) + (size_t)channel * (size_t)delayBufferLength;
+    }
+
+    // Zeroes the delay lines in use, whatever their storage: all-zero bytes are 0 in both formats
+    void clearDelayLines() noexcept
+    {
+        if (delayPool != nullptr)
+            std::memset(delayPool.get(), 0, (size_t)numChannels * (size_t)delayBufferLength * sizeof(float));
+    }
+
+    // Packs count samples into a compact delay line from position write on, wrapping around once at most
+    void writeCompact(int16_t* delayData, int write, const float* source, int count) const noexcept;
+
+    // Converts the delay lines in use between the storage formats, in place
+    void setDelayStorage(int storage) noexcept;
+
+    // Switches the delay lines to another range: clears them and fades the wet signal in
+    void setDelayRange(int range) noexcept;
+
+    // The first two sidechain channels, offset to the current sub-block; null when there is no sidechain
+    struct SidechainView
+    {
+        const float* left = nullptr;
+        const float* right = nullptr;
+
+        float getSample(int i) const noexcept
+        {
+            return left == nullptr ? 0.0f : (right == nullptr ? left[i] : 0.5f * (left[i] + right[i]));
+        }
+    };
+
+    void processSubBlock(const float* const* input, float* const* output, int startSample,
+                         int numSamples, int numDelayChannels, const Parameters& params,
+                         const SidechainView& sidechain) noexcept;
+
+    // Fills delayTimes with the delay (in samples) of each sample and advances the LFO; returns the smallest delay.
+    // envelopeTarget is the level the envelope follower moves towards in this block, if it is on. With targets
+    // of the matrix (bits of MatrixTarget), also fills the ramps of the ones that need them.
+    float renderDelayTimes(int numSamples, const Parameters& params, float envelopeTarget,
+                           const SidechainView& sidechain, int matrixTargets) noexcept;
+
+    // Bits of the matrix targets this block renders: those of the active slots, and those still ramping back to 0.
+    // Drops the stereo phase when the LFO is not what sweeps the delay of the second channel.
+    int updateMatrixTargets(const Parameters& params, int numDelayChannels) noexcept;
+
+    // Sum of the active slots on each target, from the current state of the sources
+    void evaluateMatrix(const Parameters& params, float lfo, float env, float* targets) const noexcept;
+
+    // Fills barberpoleDelays and barberpoleWindows for the direction given, from the LFO phase at the start of the block;
+    // returns the smallest delay any tap can have
+    float renderBarberpoleTaps(int numSamples, const Parameters& params, int direction, float startPhase) noexcept;
+
+    // kRandomWave and kMatrixRandom: the value of the next period, from a 32-bit LCG
+    static float nextRandomValue(uint32_t& state) noexcept
+    {
+        state = state * 1664525u + 1013904223u;
+        return (float)(state >> 8) / 16777216.0f;
+    }
+
+    // Converts the first two delay lines between left/right and mid/side
+    void convertDelayLines(bool toMidSide) noexcept;
+
+    // Reads the wet signal of one chunk for a read mode and a barberpole mode into wet; times are the delay times
+    // of the block, delayTimes or stereoDelayTimes
+    template <typename Sample>
+    void readWet(const Sample* delayData, int dpw, const float* times, int chunkStart, int chunkLength,
+                 int readMode, int barberpole, float* wet) noexcept;
+
+    // Audio thread: swaps in the pending wavetable, if the previous one has been collected
+    void acquireWavetable() noexcept;
+
+    // Peak or RMS of the input of a sub-block, over all the channels
+    static float measureLevel(const float* const* input, int startSample, int numSamples,
+                              int numChannelsToMeasure, int detector) noexcept;
+
+    static bool isEnvelopeFollowerOn(const Parameters& params) noexcept
+    {
+        if (params.envelopeToDelay != 0.0f || params.envelopeToSweep != 0.0f)
+            return true;
+
+        for (const auto& slot : params.modulation)
+            if (slot.isActive() && slot.source == kMatrixEnvelope)
+                return true;
+
+        return false;
+    }
+
+    template <typename Sample>
+    void readDelayLine(const Sample* delayData, int dpw, const float* delays, float* wet,
+                       int numSamples, int readMode) const noexcept;
+
+    double sampleRate = 44100.0;
+    double inverseSampleRate = 1.0 / 44100.0;
+    int numChannels = 0;
+
+    // Variables for the delay circular buffer: length, one buffer per channel stored back to back, write pointer.
+    // The buffers sit at the start of the pool, which is left uninitialised beyond what prepare() clears. The pool is
+    // raw bytes, seen as float or int16_t samples depending on the storage, and only ever cleared bytewise, so that
+    // neither type is ever read through the other; setDelayStorage() converts between them with memcpy.
+    int delayBufferLength = 1;
+    std::unique_ptr<unsigned char[]> delayPool;
+    size_t delayPoolSize = 0;       // in float samples
+    size_t delayPoolTouched = 0;    // float samples at the start of the pool written since it was allocated
+    int delayBufferWrite = 0;
+    int delayRange = kFlangeRange;
+    int delayStorage = kFloatStorage;
+
+    // Per-block scratch buffers, sized by prepare()
+    int maximumBlockSize = 0;
+    std::vector<float> delayTimes;
+    std::vector<float> wetBuffer;
+    std::vector<float> fadeBuffer;
+    std::vector<float> midSideBuffer;   // kMidSide: mid then side, maximumBlockSize samples each
+    std::vector<float> storeBuffer;     // kCompactStorage: a chunk of delay line input, before it is packed
+    bool delayLinesMidSide = false;     // whether the first two delay lines hold mid and side
+
+    // Barberpole taps: kBarberpoleTaps rows of maximumBlockSize delays and windows, plus one tap of scratch
+    std::vector<float> barberpoleDelays;
+    std::vector<float> barberpoleWindows;
+    std::vector<float> tapBuffer;
+    std::vector<float> tapDelays;
+    int barberpoleDirection = kBarberpoleRising;   // direction barberpoleDelays were rendered for
+    float barberpoleCentre = 0.0f;                  // middle of the sweep in samples, to mirror the direction
+
+    float lfoPhase = 0.0f;
+
+    // kRandomWave: the value held in the previous period and the one of the current period
+    uint32_t randomState = 1;
+    float randomFrom = 0.5f;
+    float randomTo = 0.5f;
+
+    // kWavetableWave: the table in use belongs to the audio thread; the pending one travels from the thread that
+    // set it, and the retired one back to it, to be deleted there
+    Wavetable* wavetable = nullptr;
+    std::atomic<Wavetable*> pendingWavetable { nullptr };
+    std::atomic<Wavetable*> retiredWavetable { nullptr };
+    float envelope = 0.0f;
+    float sidechainEnvelope = 0.0f;
+
+    // Modulation matrix: the value of each target at the end of the last block, which the next ramps start from,
+    // the phase of the second LFO, and the random values of its previous and current periods
+    float matrixValues[kNumMatrixTargets] = {};
+    float lfo2Phase = 0.0f;
+    uint32_t matrixRandomState = 2;
+    float matrixRandomFrom = 0.5f;
+    float matrixRandomTo = 0.5f;
+
+    // Per-sample ramps of the matrix targets the channel loop reads: feedback and gain offsets, and the delay times
+    // of the second channel with the stereo phase
+    std::vector<float> feedbackRamp;
+    std::vector<float> gainRamp;
+    std::vector<float> stereoDelayTimes;
+
+    // Read mode of the previous block: a change is crossfaded over one block. -1 after reset(), when there is nothing to fade from
+    int lastReadMode = -1;
+    int lastBarberpole = kBarberpoleOff;
+
+    // Set by processBypassed() and range changes: the next block fades the wet signal in
+    bool fadeInWet = false;
+
+    std::atomic<uint64_t> stageCycles[kNumStages] {};
+};
+
+} // namespace flanger
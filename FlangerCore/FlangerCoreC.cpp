@@ -0,0 +1,155 @@
+/*
+  ==============================================================================
+
+    FlangerCoreC.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "FlangerCoreC.h"
+#include "FlangerCore.h"
+
+#include <new>
+
+struct FlangerCoreInstance
+{
+    flanger::FlangerCore core;
+};
+
+namespace
+{
+    flanger::Parameters toCoreParameters(const FlangerCoreParameters& p) noexcept
+    {
+        flanger::Parameters params;
+        params.delay = p.delay;
+        params.sweep = p.sweep;
+        params.feedback = p.feedback;
+        params.gain = p.gain;
+        params.speed = p.speed;
+        params.wave = p.wave;
+        params.interpol = p.interpol;
+        params.polarity = p.polarity;
+        params.randomSlew = p.randomSlew;
+        params.quality = p.quality;
+        params.modulationSource = p.modulationSource;
+        params.barberpole = p.barberpole;
+        params.delayRange = p.delayRange;
+        params.delayStorage = p.delayStorage;
+        params.stereoMode = p.stereoMode;
+        params.sideGain = p.sideGain;
+        params.sideFeedback = p.sideFeedback;
+        params.envelopeToDelay = p.envelopeToDelay;
+        params.envelopeToSweep = p.envelopeToSweep;
+        params.envelopeAttack = p.envelopeAttack;
+        params.envelopeRelease = p.envelopeRelease;
+        params.envelopeDetector = p.envelopeDetector;
+        return params;
+    }
+}
+
+//==============================================================================
+void flanger_core_default_parameters(FlangerCoreParameters* params)
+{
+    if (params == nullptr)
+        return;
+
+    const flanger::Parameters defaults;
+    params->delay = defaults.delay;
+    params->sweep = defaults.sweep;
+    params->feedback = defaults.feedback;
+    params->gain = defaults.gain;
+    params->speed = defaults.speed;
+    params->wave = defaults.wave;
+    params->interpol = defaults.interpol;
+    params->polarity = defaults.polarity;
+    params->randomSlew = defaults.randomSlew;
+    params->quality = defaults.quality;
+    params->modulationSource = defaults.modulationSource;
+    params->barberpole = defaults.barberpole;
+    params->delayRange = defaults.delayRange;
+    params->delayStorage = defaults.delayStorage;
+    params->stereoMode = defaults.stereoMode;
+    params->sideGain = defaults.sideGain;
+    params->sideFeedback = defaults.sideFeedback;
+    params->envelopeToDelay = defaults.envelopeToDelay;
+    params->envelopeToSweep = defaults.envelopeToSweep;
+    params->envelopeAttack = defaults.envelopeAttack;
+    params->envelopeRelease = defaults.envelopeRelease;
+    params->envelopeDetector = defaults.envelopeDetector;
+}
+
+FlangerCoreInstance* flanger_core_create(void)
+{
+    return new (std::nothrow) FlangerCoreInstance();
+}
+
+void flanger_core_destroy(FlangerCoreInstance* instance)
+{
+    delete instance;
+}
+
+int flanger_core_prepare(FlangerCoreInstance* instance, double sampleRate, int numChannels, int maximumBlockSize)
+{
+    if (instance == nullptr || sampleRate <= 0.0 || numChannels < 0 || maximumBlockSize < 0)
+        return -1;
+
+    try
+    {
+        instance->core.prepare(sampleRate, numChannels, maximumBlockSize);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+void flanger_core_reset(FlangerCoreInstance* instance)
+{
+    if (instance != nullptr)
+        instance->core.reset();
+}
+
+int flanger_core_set_wavetable(FlangerCoreInstance* instance, const float* points, int numPoints)
+{
+    if (instance == nullptr || numPoints < 0)
+        return -1;
+
+    try
+    {
+        instance->core.setWavetable(flanger::Wavetable::fromPoints(points, numPoints));
+    }
+    catch (const std::bad_alloc&)
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+void flanger_core_process(FlangerCoreInstance* instance,
+                          const float* const* input, float* const* output,
+                          int numChannels, int numSamples,
+                          const FlangerCoreParameters* params)
+{
+    if (instance == nullptr || params == nullptr || numChannels <= 0 || numSamples <= 0)
+        return;
+
+    instance->core.process(input, output, numChannels, numSamples, toCoreParameters(*params));
+}
+
+void flanger_core_process_sidechain(FlangerCoreInstance* instance,
+                                    const float* const* input, float* const* output,
+                                    int numChannels, int numSamples,
+                                    const FlangerCoreParameters* params,
+                                    const float* const* sidechain, int numSidechainChannels)
+{
+    if (instance == nullptr || params == nullptr || numChannels <= 0 || numSamples <= 0)
+        return;
+
+    instance->core.process(input, output, numChannels, numSamples, toCoreParameters(*params),
+                           sidechain, numSidechainChannels);
+}
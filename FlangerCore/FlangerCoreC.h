@@ -0,0 +1,157 @@
+/*
+  ==============================================================================
+
+    FlangerCoreC.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Plain C interface to flanger::FlangerCore, for hosts that cannot use C++.
+
+  ==============================================================================
+*/
+
+#ifndef FLANGER_CORE_C_H
+#define FLANGER_CORE_C_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque handle to one flanger instance */
+typedef struct FlangerCoreInstance FlangerCoreInstance;
+
+/* Values for FlangerCoreParameters::wave */
+enum
+{
+    FLANGER_WAVE_SINE = 0,
+    FLANGER_WAVE_TRIANGLE = 1,
+    FLANGER_WAVE_SQUARE = 2,
+    FLANGER_WAVE_SAW = 3,
+    FLANGER_WAVE_RANDOM = 4,
+    FLANGER_WAVE_WAVETABLE = 5
+};
+
+/* Values for FlangerCoreParameters::interpol */
+enum
+{
+    FLANGER_INTERPOL_LINEAR = 0,
+    FLANGER_INTERPOL_QUADRATIC = 1,
+    FLANGER_INTERPOL_CUBIC = 2
+};
+
+/* Values for FlangerCoreParameters::quality */
+enum
+{
+    FLANGER_QUALITY_HIGH = 0,
+    FLANGER_QUALITY_ECO = 1
+};
+
+/* Values for FlangerCoreParameters::modulationSource */
+enum
+{
+    FLANGER_MODULATION_LFO = 0,
+    FLANGER_MODULATION_SIDECHAIN = 1,
+    FLANGER_MODULATION_SIDECHAIN_ENVELOPE = 2
+};
+
+/* Values for FlangerCoreParameters::barberpole */
+enum
+{
+    FLANGER_BARBERPOLE_OFF = 0,
+    FLANGER_BARBERPOLE_RISING = 1,
+    FLANGER_BARBERPOLE_FALLING = 2
+};
+
+/* Values for FlangerCoreParameters::delayRange */
+enum
+{
+    FLANGER_RANGE_FLANGE = 0,
+    FLANGER_RANGE_CHORUS = 1,
+    FLANGER_RANGE_DOUBLER = 2
+};
+
+/* Values for FlangerCoreParameters::delayStorage */
+enum
+{
+    FLANGER_STORAGE_FLOAT = 0,
+    FLANGER_STORAGE_COMPACT = 1
+};
+
+/* Values for FlangerCoreParameters::stereoMode */
+enum
+{
+    FLANGER_STEREO_LEFT_RIGHT = 0,
+    FLANGER_STEREO_MID_SIDE = 1
+};
+
+/* Values for FlangerCoreParameters::envelopeDetector */
+enum
+{
+    FLANGER_ENVELOPE_PEAK = 0,
+    FLANGER_ENVELOPE_RMS = 1
+};
+
+/* Times are in seconds, gains are linear: see flanger::Parameters */
+typedef struct FlangerCoreParameters
+{
+    float delay;
+    float sweep;
+    float feedback;
+    float gain;
+    float speed;
+    int wave;
+    int interpol;
+    int polarity;
+    float randomSlew;
+    int quality;
+    int modulationSource;
+    int barberpole;
+    int delayRange;
+    int delayStorage;
+    int stereoMode;
+    float sideGain;
+    float sideFeedback;
+    float envelopeToDelay;
+    float envelopeToSweep;
+    float envelopeAttack;
+    float envelopeRelease;
+    int envelopeDetector;
+} FlangerCoreParameters;
+
+/* Fills params with the defaults of the plugin */
+void flanger_core_default_parameters(FlangerCoreParameters* params);
+
+/* Returns NULL if the instance could not be allocated */
+FlangerCoreInstance* flanger_core_create(void);
+void flanger_core_destroy(FlangerCoreInstance* instance);
+
+/* Allocates the delay lines. Returns 0 on success, -1 on invalid arguments or allocation failure */
+int flanger_core_prepare(FlangerCoreInstance* instance, double sampleRate, int numChannels, int maximumBlockSize);
+
+/* Clears the delay lines and the LFO phase without reallocating */
+void flanger_core_reset(FlangerCoreInstance* instance);
+
+/* Sets the FLANGER_WAVE_WAVETABLE shape: numPoints values in the range 0-1 over one period.
+   It allocates, so call it from one control thread, never the audio thread; processing may
+   run meanwhile. NULL points give a flat line. Returns 0 on success, -1 on allocation failure */
+int flanger_core_set_wavetable(FlangerCoreInstance* instance, const float* points, int numPoints);
+
+/* Processes numSamples samples per channel; input and output may be the same buffers */
+void flanger_core_process(FlangerCoreInstance* instance,
+                          const float* const* input, float* const* output,
+                          int numChannels, int numSamples,
+                          const FlangerCoreParameters* params);
+
+/* Same as flanger_core_process, with a sidechain of numSidechainChannels channels
+   for the FLANGER_MODULATION_SIDECHAIN sources; it is read in place */
+void flanger_core_process_sidechain(FlangerCoreInstance* instance,
+                                    const float* const* input, float* const* output,
+                                    int numChannels, int numSamples,
+                                    const FlangerCoreParameters* params,
+                                    const float* const* sidechain, int numSidechainChannels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLANGER_CORE_C_H */
@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    FlangerKernels.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    The per-sample arithmetic of the flanger: the periodic LFO shapes and the
+    fractional delay interpolators. FlangerCore and FlangerBatch both build
+    on these, so a lane of a batch sounds exactly like a mono FlangerCore.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "FlangerTables.h"
+
+namespace flanger
+{
+namespace kernels
+{
+
+//==============================================================================
+// LFO shapes in the range 0-1, at a phase in [0, 1)
+inline float sineShape(float ph) noexcept
+{
+    return 0.5f + 0.5f * tables::sine(ph);
+}
+
+inline float triangleShape(float ph) noexcept
+{
+    return ph < 0.25f ? 0.5f + 2.0f * ph
+                      : (ph < 0.75f ? 1.0f - 2.0f * (ph - 0.25f) : 2.0f * (ph - 0.75f));
+}
+
+inline float squareShape(float ph) noexcept
+{
+    return ph < 0.5f ? 1.0f : 0.0f;
+}
+
+inline float sawShape(float ph) noexcept
+{
+    return ph < 0.5f ? 0.5f + ph : ph - 0.5f;
+}
+
+//==============================================================================
+// Interpolators between the samples around a fractional read position: s1 is the sample at the position,
+// s0 the one before it and s2, s3 the two after it. Linear fits a line between two samples, quadratic a
+// parabola through three and cubic a 3rd order polynomial through four.
+inline float interpolateLinear(float fraction, float s1, float s2) noexcept
+{
+    return fraction * s2 + (1.0f - fraction) * s1;
+}
+
+inline float interpolateQuadratic(float fraction, float s0, float s1, float s2) noexcept
+{
+    const float a1 = 0.5f * (s2 - s0);
+    const float a2 = 0.5f * (s0 + s2) - s1;
+
+    return s1 + fraction * (a1 + fraction * a2);
+}
+
+// Catmull-Rom variant of cubic interpolation
+inline float interpolateCubic(float fraction, float s0, float s1, float s2, float s3) noexcept
+{
+    const float frsq = fraction * fraction;
+
+    const float a0 = -0.5f * s0 + 1.5f * s1 - 1.5f * s2 + 0.5f * s3;
+    const float a1 = s0 - 2.5f * s1 + 2.0f * s2 - 0.5f * s3;
+    const float a2 = -0.5f * s0 + 0.5f * s2;
+    const float a3 = s1;
+
+    return a0 * fraction * frsq + a1 * frsq + a2 * fraction + a3;
+}
+
+} // namespace kernels
+} // namespace flanger
@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+
+    FlangerProfiler.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "FlangerProfiler.h"
+
+#include <algorithm>
+
+namespace flanger
+{
+
+constexpr int BlockProfiler::kBinsPerDeadline;
+constexpr int BlockProfiler::kNumBins;
+
+const char* getStageName(int stage) noexcept
+{
+    switch (stage)
+    {
+    case kLfoStage: return "LFO";
+    case kInterpolationStage: return "interpolation";
+    case kFeedbackStage: return "feedback";
+    default: return "";
+    }
+}
+
+namespace
+{
+    double measureCycleCounterFrequency()
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const auto startTime = Clock::now();
+        const auto startCycles = readCycleCounter();
+
+        while (Clock::now() - startTime < std::chrono::milliseconds(5))
+        {
+        }
+
+        const auto cycles = readCycleCounter() - startCycles;
+        const std::chrono::duration<double> seconds = Clock::now() - startTime;
+
+        return seconds.count() > 0.0 ? (double)cycles / seconds.count() : 1.0e9;
+    }
+}
+
+double getCycleCounterFrequency()
+{
+    // Thread-safe one-off initialisation, shared by every instance in the process
+    static const double frequency = measureCycleCounterFrequency();
+    return frequency;
+}
+
+//==============================================================================
+void BlockProfiler::prepare(double sampleRate)
+{
+    cyclesPerSample = sampleRate > 0.0 ? getCycleCounterFrequency() / sampleRate : 0.0;
+    reset();
+}
+
+void BlockProfiler::reset() noexcept
+{
+    for (auto& bin : bins)
+        bin.store(0, std::memory_order_relaxed);
+
+    numBlocks.store(0, std::memory_order_relaxed);
+    numDeadlineMisses.store(0, std::memory_order_relaxed);
+    totalCycles.store(0, std::memory_order_relaxed);
+    totalSamples.store(0, std::memory_order_relaxed);
+    worstLoad.store(0.0f, std::memory_order_relaxed);
+    lastLoad.store(0.0f, std::memory_order_relaxed);
+}
+
+void BlockProfiler::addBlock(uint64_t cycles, int numSamples) noexcept
+{
+    if (numSamples <= 0 || cyclesPerSample <= 0.0)
+        return;
+
+    // Single writer: plain relaxed loads and stores, no read-modify-write instructions
+    const auto load = (float)((double)cycles / (cyclesPerSample * numSamples));
+    const auto bin = std::min((int)(load * (float)kBinsPerDeadline), kNumBins - 1);
+
+    lastLoad.store(load, std::memory_order_relaxed);
+
+    bins[bin].store(bins[bin].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    numBlocks.store(numBlocks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    totalCycles.store(totalCycles.load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
+    totalSamples.store(totalSamples.load(std::memory_order_relaxed) + (uint64_t)numSamples, std::memory_order_relaxed);
+
+    if (load > 1.0f)
+        numDeadlineMisses.store(numDeadlineMisses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (load > worstLoad.load(std::memory_order_relaxed))
+        worstLoad.store(load, std::memory_order_relaxed);
+}
+
+BlockProfiler::Snapshot BlockProfiler::getSnapshot() const noexcept
+{
+    Snapshot snapshot {};
+
+    for (int i = 0; i < kNumBins; ++i)
+        snapshot.bins[i] = bins[i].load(std::memory_order_relaxed);
+
+    snapshot.numBlocks = numBlocks.load(std::memory_order_relaxed);
+    snapshot.numDeadlineMisses = numDeadlineMisses.load(std::memory_order_relaxed);
+    snapshot.worstLoad = worstLoad.load(std::memory_order_relaxed);
+
+    const auto samples = totalSamples.load(std::memory_order_relaxed);
+    snapshot.meanLoad = samples > 0 && cyclesPerSample > 0.0
+                      ? (double)totalCycles.load(std::memory_order_relaxed) / (cyclesPerSample * (double)samples)
+                      : 0.0;
+
+    return snapshot;
+}
+
+} // namespace flanger
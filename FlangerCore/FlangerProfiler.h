@@ -0,0 +1,167 @@
+/*
+  ==============================================================================
+
+    FlangerProfiler.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Cheap self-profiling for the audio thread:
+
+    - BlockProfiler keeps a lock-free histogram of block processing times
+      relative to the buffer deadline (numSamples / sampleRate). Feeding it
+      costs two cycle counter reads and a handful of relaxed stores per block.
+      The plugin feeds it unless built with FLANGER_BLOCK_PROFILER=0.
+    - FLANGER_TRACE_STAGE marks a scope as one of the DSP stages. The markers
+      are compiled in only with FLANGER_TRACE_STAGES=1 and are empty otherwise.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+ #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+ #include <x86intrin.h>
+#endif
+
+// Per-block timing in the plugin; define it to 0 to compile it out
+#ifndef FLANGER_BLOCK_PROFILER
+ #define FLANGER_BLOCK_PROFILER 1
+#endif
+
+#ifndef FLANGER_TRACE_STAGES
+ #define FLANGER_TRACE_STAGES 0
+#endif
+
+namespace flanger
+{
+
+//==============================================================================
+// The stages of FlangerCore::process() that can be traced
+enum Stage
+{
+    kLfoStage = 0,
+    kInterpolationStage,
+    kFeedbackStage,
+    kNumStages
+};
+
+const char* getStageName(int stage) noexcept;
+
+//==============================================================================
+// A free-running counter: the TSC on x86, the virtual counter on ARM64, a steady clock elsewhere
+inline uint64_t readCycleCounter() noexcept
+{
+   #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+   #elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+   #elif defined(__aarch64__)
+    uint64_t value;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+   #else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+   #endif
+}
+
+// Ticks of readCycleCounter() per second, measured once per process on first use (takes a few milliseconds)
+double getCycleCounterFrequency();
+
+//==============================================================================
+// Adds the cycles spent in its scope to a stage counter
+class ScopedStageTrace
+{
+public:
+    explicit ScopedStageTrace(std::atomic<uint64_t>& counterToUse) noexcept
+        : counter(counterToUse), start(readCycleCounter()) {}
+
+    ~ScopedStageTrace() noexcept
+    {
+        // Single writer: a relaxed load and store is enough and avoids a locked instruction
+        counter.store(counter.load(std::memory_order_relaxed) + (readCycleCounter() - start), std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t>& counter;
+    const uint64_t start;
+};
+
+#if FLANGER_TRACE_STAGES
+ #define FLANGER_TRACE_STAGE(stageCounters, stage) const flanger::ScopedStageTrace stageTrace((stageCounters)[stage])
+#else
+ #define FLANGER_TRACE_STAGE(stageCounters, stage)
+#endif
+
+//==============================================================================
+/**
+    Histogram of block durations relative to the buffer deadline.
+
+    addBlock() must only be called from one thread (the audio thread); any
+    thread can read a snapshot at any time. Each bin covers 1/kBinsPerDeadline
+    of the deadline, the last one also counts everything slower.
+*/
+class BlockProfiler
+{
+public:
+    static constexpr int kBinsPerDeadline = 20;
+    static constexpr int kNumBins = 2 * kBinsPerDeadline + 1;
+
+    struct Snapshot
+    {
+        uint32_t bins[kNumBins];
+        uint64_t numBlocks;
+        uint64_t numDeadlineMisses;
+        double meanLoad;      // total processing time / total audio time
+        double worstLoad;     // slowest block / its deadline
+    };
+
+    BlockProfiler() noexcept { reset(); }
+
+    // Call before processing, off the audio thread
+    void prepare(double sampleRate);
+
+    // Clears the statistics; racing with addBlock() only loses that block
+    void reset() noexcept;
+
+    void addBlock(uint64_t cycles, int numSamples) noexcept;
+
+    Snapshot getSnapshot() const noexcept;
+
+    // Load of the most recent block (its duration / its deadline), 0 before the first one
+    float getLastLoad() const noexcept { return lastLoad.load(std::memory_order_relaxed); }
+
+private:
+    double cyclesPerSample = 0.0;
+
+    std::atomic<uint32_t> bins[kNumBins];
+    std::atomic<uint64_t> numBlocks;
+    std::atomic<uint64_t> numDeadlineMisses;
+    std::atomic<uint64_t> totalCycles;
+    std::atomic<uint64_t> totalSamples;
+    std::atomic<float> worstLoad;
+    std::atomic<float> lastLoad;
+};
+
+//==============================================================================
+// Times its scope and feeds the duration to a BlockProfiler
+class ScopedBlockTimer
+{
+public:
+    ScopedBlockTimer(BlockProfiler& profilerToUse, int numSamplesInBlock) noexcept
+        : profiler(profilerToUse), numSamples(numSamplesInBlock), start(readCycleCounter()) {}
+
+    ~ScopedBlockTimer() noexcept { profiler.addBlock(readCycleCounter() - start, numSamples); }
+
+private:
+    BlockProfiler& profiler;
+    const int numSamples;
+    const uint64_t start;
+};
+
+} // namespace flanger
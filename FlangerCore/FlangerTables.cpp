@@ -0,0 +1,26 @@
+/*
+  ==============================================================================
+
+    FlangerTables.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "FlangerTables.h"
+
+namespace flanger
+{
+namespace tables
+{
+
+// A single definition for the whole process: evaluated by the compiler and emitted as read-only data
+extern constexpr SineTable sineTable = makeSineTable();
+
+static_assert(sineTable.values[0] == 0.0f, "the sine table must be generated at compile time");
+static_assert(sineTable.values[kSineTableSize / 4] > 0.9999f && sineTable.values[kSineTableSize / 4] <= 1.0f,
+              "the sine table must peak a quarter period in");
+
+} // namespace tables
+} // namespace flanger
@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    FlangerTables.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Lookup tables generated at compile time. They live in read-only storage
+    and are shared by every flanger instance in the process, so creating an
+    instance never builds a table.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+namespace flanger
+{
+namespace tables
+{
+
+//==============================================================================
+// One period of sin(2 pi x), plus a guard point so the interpolation never wraps
+constexpr int kSineTableSize = 1024;
+
+struct SineTable
+{
+    float values[kSineTableSize + 1];
+};
+
+constexpr double kTwoPi = 6.283185307179586476925286766559;
+
+// cos(x) for small x, from its Taylor series
+constexpr double taylorCos(double x)
+{
+    double term = 1.0;
+    double sum = 1.0;
+
+    for (int n = 1; n < 12; ++n)
+    {
+        term *= -x * x / (double)((2 * n - 1) * (2 * n));
+        sum += term;
+    }
+
+    return sum;
+}
+
+// sin(n * step) from the recurrence sin((n + 1) step) = 2 cos(step) sin(n step) - sin((n - 1) step):
+// a handful of operations per entry keeps the constant evaluation cheap for every compiler
+constexpr SineTable makeSineTable()
+{
+    SineTable table {};
+
+    const double step = kTwoPi / kSineTableSize;
+    const double twoCosStep = 2.0 * taylorCos(step);
+
+    double previous = -taylorCos(kTwoPi * 0.25 - step);  // sin(-step)
+    double current = 0.0;
+
+    for (int i = 0; i <= kSineTableSize; ++i)
+    {
+        table.values[i] = (float)current;
+
+        const double next = twoCosStep * current - previous;
+        previous = current;
+        current = next;
+    }
+
+    return table;
+}
+
+extern const SineTable sineTable;
+
+//==============================================================================
+// sin(2 pi phase) for a phase in [0, 1), linearly interpolated from the shared table. The index is unsigned
+// 32-bit, which loops over many phases can gather with; a signed one would be widened to 64 bits first.
+inline float sine(float phase) noexcept
+{
+    const float position = phase * (float)kSineTableSize;
+    const int index = (int)position;
+    const float fraction = position - (float)index;
+
+    const float* values = sineTable.values;
+    return values[(unsigned int)index] + fraction * (values[(unsigned int)index + 1] - values[(unsigned int)index]);
+}
+
+} // namespace tables
+} // namespace flanger
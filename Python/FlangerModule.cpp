@@ -0,0 +1,765 @@
+/*
+  ==============================================================================
+
+    FlangerModule.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    The "flanger" Python module: FlangerCore over NumPy arrays, or anything
+    else that exports a buffer of float32 or float64 samples, with the IDs,
+    ranges and units of the plugin parameters.
+
+        import flanger, numpy as np
+        fx = flanger.Flanger(48000, channels=2, batch=1, block_size=128)
+        fx.set_parameters({"DELAY": 12.0, "FB": 0.8, "WAVE": 1})
+        y = fx.process(x)                                 # x: (samples,), (channels, samples) or (batch, channels, samples)
+        y = fx.process(x, params={"SWEEP": sweeps})       # sweeps: (samples,) or (batch, samples)
+        fx.process(x, out=x)                              # in place
+
+    process() reads the input and writes the output where they are, with no
+    copy (float64 goes through one block of float32 at a time), and runs
+    without the GIL, so Python threads with one Flanger each use every core.
+    Each block is one FlangerCore::process() call with the parameters
+    converted by toCoreParameters(), exactly what processBlock() does: a
+    render matches the plugin run at the same block size. Per-sample
+    parameter arrays are read at the first sample of each block, like host
+    automation.
+
+  ==============================================================================
+*/
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "FlangerCore.h"
+#include "../Source/FlangerParameterTable.h"
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined (__SSE__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP > 0)
+ #include <xmmintrin.h>
+#endif
+
+namespace
+{
+    //==============================================================================
+    // Flush-to-zero and denormals-are-zero while processing, as juce::ScopedNoDenormals in processBlock()
+    class ScopedNoDenormals
+    {
+    public:
+        ScopedNoDenormals() noexcept
+        {
+           #if defined (__SSE__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP > 0)
+            previous = _mm_getcsr();
+            _mm_setcsr(previous | 0x8040);
+           #elif defined (__aarch64__)
+            asm volatile ("mrs %0, fpcr" : "=r" (previous));
+            asm volatile ("msr fpcr, %0" : : "r" (previous | (1ull << 24)));
+           #endif
+        }
+
+        ~ScopedNoDenormals() noexcept
+        {
+           #if defined (__SSE__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP > 0)
+            _mm_setcsr(previous);
+           #elif defined (__aarch64__)
+            asm volatile ("msr fpcr, %0" : : "r" (previous));
+           #endif
+        }
+
+    private:
+       #if defined (__aarch64__)
+        unsigned long long previous = 0;
+       #else
+        unsigned int previous = 0;
+       #endif
+    };
+
+    //==============================================================================
+    // A Py_buffer released when it goes out of scope
+    class BufferView
+    {
+    public:
+        BufferView() noexcept { view.obj = nullptr; }
+        ~BufferView() { release(); }
+
+        BufferView(const BufferView&) = delete;
+        BufferView& operator=(const BufferView&) = delete;
+
+        // False with a Python error set if the object exports no buffer of float32 or float64
+        bool acquire(PyObject* object, bool writable, const char* what)
+        {
+            if (PyObject_GetBuffer(object, &view, PyBUF_STRIDES | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0)) != 0)
+            {
+                view.obj = nullptr;
+                return false;
+            }
+
+            const char* format = view.format != nullptr ? view.format : "B";
+
+            // NumPy gives the native byte order as no prefix; '=' and '@' say the same
+            if (*format == '@' || *format == '=' || (PY_LITTLE_ENDIAN && *format == '<') || (! PY_LITTLE_ENDIAN && *format == '>'))
+                ++format;
+
+            if (std::strcmp(format, "f") == 0 && view.itemsize == 4)
+                isDouble = false;
+            else if (std::strcmp(format, "d") == 0 && view.itemsize == 8)
+                isDouble = true;
+            else
+            {
+                PyErr_Format(PyExc_TypeError, "%s must hold float32 or float64 samples in the native byte order", what);
+                release();
+                return false;
+            }
+
+            return true;
+        }
+
+        void release()
+        {
+            if (view.obj != nullptr)
+                PyBuffer_Release(&view);
+
+            view.obj = nullptr;
+        }
+
+        int getNumDimensions() const noexcept { return view.ndim; }
+        Py_ssize_t getSize(int dimension) const noexcept { return view.shape[dimension]; }
+        Py_ssize_t getStride(int dimension) const noexcept { return view.strides[dimension]; }
+        char* getData() const noexcept { return static_cast<char*>(view.buf); }
+
+        Py_buffer view;
+        bool isDouble = false;
+    };
+
+    //==============================================================================
+    // A per-sample parameter of a process() call: an array of (samples,) shared by the batch or of
+    // (batch, samples), read at the start of each block
+    struct ParameterSource
+    {
+        FlangerParameters::Index index;
+        std::unique_ptr<BufferView> values;
+
+        float get(Py_ssize_t item, Py_ssize_t sample) const noexcept
+        {
+            const char* data = values->getData() + sample * values->getStride(values->getNumDimensions() - 1);
+
+            if (values->getNumDimensions() == 2)
+                data += item * values->getStride(0);
+
+            return values->isDouble ? (float)*reinterpret_cast<const double*>(data) : *reinterpret_cast<const float*>(data);
+        }
+    };
+
+    //==============================================================================
+    // One FlangerCore per item of a batch, each a stream that carries on from one process() call to the next
+    struct Engine
+    {
+        double sampleRate = 48000.0;
+        int numChannels = 2;
+        int blockSize = 128;
+
+        std::vector<std::unique_ptr<flanger::FlangerCore>> cores;
+        FlangerParameters::Snapshot values = FlangerParameters::getDefaults();
+        std::vector<float> scratch;     // float64 arrays: one block per channel, converted in and out
+
+        // Held by whichever thread processes or changes the engine, without the GIL
+        std::mutex mutex;
+    };
+
+    struct FlangerObject
+    {
+        PyObject_HEAD
+        Engine* engine;
+    };
+
+    // The row of kTable a dict key names, or nullptr with a KeyError set
+    const FlangerParameters::Info* getInfo(PyObject* key)
+    {
+        const char* id = PyUnicode_Check(key) ? PyUnicode_AsUTF8(key) : nullptr;
+
+        if (id == nullptr)
+        {
+            if (! PyErr_Occurred())
+                PyErr_SetString(PyExc_TypeError, "parameter IDs must be strings");
+
+            return nullptr;
+        }
+
+        const auto* info = FlangerParameters::findInfo(id);
+
+        if (info == nullptr)
+            PyErr_Format(PyExc_KeyError, "unknown parameter ID '%s'", id);
+
+        return info;
+    }
+
+    bool checkEngine(FlangerObject* self)
+    {
+        if (self->engine != nullptr)
+            return true;
+
+        PyErr_SetString(PyExc_RuntimeError, "Flanger.__init__() was not called");
+        return false;
+    }
+
+    // The value of a number, or of an array with no dimension (a NumPy scalar), as a float
+    bool getNumber(PyObject* value, const char* id, float& number)
+    {
+        if (PyObject_CheckBuffer(value))
+        {
+            BufferView view;
+
+            if (! view.acquire(value, false, id))
+                return false;
+
+            if (view.getNumDimensions() != 0)
+            {
+                PyErr_Format(PyExc_ValueError, "%s must be a number", id);
+                return false;
+            }
+
+            number = view.isDouble ? (float)*reinterpret_cast<const double*>(view.getData()) : *reinterpret_cast<const float*>(view.getData());
+            return true;
+        }
+
+        const double result = PyFloat_AsDouble(value);
+
+        if (result == -1.0 && PyErr_Occurred())
+            return false;
+
+        number = (float)result;
+        return true;
+    }
+
+    template <typename Function>
+    PyCFunction asMethod(Function function) noexcept
+    {
+        return reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(function));
+    }
+
+    //==============================================================================
+    // Processes the blocks of one item of the batch; called without the GIL
+    template <typename Sample>
+    void processItem(Engine& engine, flanger::FlangerCore& core, char* const* input, char* const* output, int numChannels,
+                     Py_ssize_t numSamples, Py_ssize_t item, const FlangerParameters::Snapshot& baseValues,
+                     const std::vector<ParameterSource>& sources)
+    {
+        std::vector<float*> channels((size_t)numChannels);
+        std::vector<const float*> inputChannels((size_t)numChannels);
+
+        for (Py_ssize_t start = 0; start < numSamples; start += engine.blockSize)
+        {
+            const int numBlockSamples = (int)std::min((Py_ssize_t)engine.blockSize, numSamples - start);
+
+            auto values = baseValues;
+
+            for (const auto& source : sources)
+                values.values[(size_t)source.index] = FlangerParameters::constrain(FlangerParameters::kTable[source.index],
+                                                                                   source.get(item, start));
+
+            const auto params = FlangerParameters::toCoreParameters(values);
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                auto* in = reinterpret_cast<Sample*>(input[channel]) + start;
+                auto* out = reinterpret_cast<Sample*>(output[channel]) + start;
+
+                if (std::is_same<Sample, float>::value)
+                {
+                    inputChannels[(size_t)channel] = reinterpret_cast<const float*>(in);
+                    channels[(size_t)channel] = reinterpret_cast<float*>(out);
+                }
+                else
+                {
+                    auto* block = engine.scratch.data() + (size_t)channel * (size_t)engine.blockSize;
+
+                    for (int i = 0; i < numBlockSamples; ++i)
+                        block[i] = (float)in[i];
+
+                    inputChannels[(size_t)channel] = block;
+                    channels[(size_t)channel] = block;
+                }
+            }
+
+            core.process(inputChannels.data(), channels.data(), numChannels, numBlockSamples, params);
+
+            if (! std::is_same<Sample, float>::value)
+            {
+                for (int channel = 0; channel < numChannels; ++channel)
+                {
+                    const auto* block = channels[(size_t)channel];
+                    auto* out = reinterpret_cast<Sample*>(output[channel]) + start;
+
+                    for (int i = 0; i < numBlockSamples; ++i)
+                        out[i] = (Sample)block[i];
+                }
+            }
+        }
+    }
+
+    //==============================================================================
+    int Flanger_init(FlangerObject* self, PyObject* args, PyObject* kwargs)
+    {
+        static const char* keywords[] = { "sample_rate", "channels", "batch", "block_size", nullptr };
+
+        double sampleRate = 0.0;
+        int numChannels = 2, batchSize = 1, blockSize = 128;
+
+        if (! PyArg_ParseTupleAndKeywords(args, kwargs, "d|iii", const_cast<char**>(keywords),
+                                          &sampleRate, &numChannels, &batchSize, &blockSize))
+            return -1;
+
+        if (! (sampleRate > 0.0) || numChannels < 1 || batchSize < 1 || blockSize < 1)
+        {
+            PyErr_SetString(PyExc_ValueError, "sample_rate, channels, batch and block_size must be positive");
+            return -1;
+        }
+
+        try
+        {
+            std::unique_ptr<Engine> engine(new Engine());
+            engine->sampleRate = sampleRate;
+            engine->numChannels = numChannels;
+            engine->blockSize = blockSize;
+            engine->scratch.resize((size_t)numChannels * (size_t)blockSize);
+
+            for (int item = 0; item < batchSize; ++item)
+            {
+                engine->cores.push_back(std::unique_ptr<flanger::FlangerCore>(new flanger::FlangerCore()));
+                engine->cores.back()->prepare(sampleRate, numChannels, blockSize);
+            }
+
+            delete self->engine;
+            self->engine = engine.release();
+        }
+        catch (const std::bad_alloc&)
+        {
+            PyErr_NoMemory();
+            return -1;
+        }
+
+        return 0;
+    }
+
+    void Flanger_dealloc(FlangerObject* self)
+    {
+        // Instances of a heap type hold a reference to it
+        auto* type = Py_TYPE(self);
+        delete self->engine;
+        type->tp_free(reinterpret_cast<PyObject*>(self));
+        Py_DECREF(type);
+    }
+
+    PyObject* Flanger_set_parameters(FlangerObject* self, PyObject* dict)
+    {
+        if (! checkEngine(self))
+            return nullptr;
+
+        if (! PyDict_Check(dict))
+        {
+            PyErr_SetString(PyExc_TypeError, "set_parameters() takes a dict of parameter IDs to values");
+            return nullptr;
+        }
+
+        // Checks every entry before changing any
+        std::vector<std::pair<FlangerParameters::Index, float>> changes;
+        PyObject *key, *value;
+        Py_ssize_t position = 0;
+
+        while (PyDict_Next(dict, &position, &key, &value))
+        {
+            const auto* info = getInfo(key);
+            float number = 0.0f;
+
+            if (info == nullptr || ! getNumber(value, info->id, number))
+                return nullptr;
+
+            changes.emplace_back(info->index, FlangerParameters::constrain(*info, number));
+        }
+
+        Engine& engine = *self->engine;
+
+        Py_BEGIN_ALLOW_THREADS
+        {
+            const std::lock_guard<std::mutex> lock(engine.mutex);
+
+            for (const auto& change : changes)
+                engine.values.values[(size_t)change.first] = change.second;
+        }
+        Py_END_ALLOW_THREADS
+
+        Py_RETURN_NONE;
+    }
+
+    PyObject* Flanger_get_parameters(FlangerObject* self, PyObject*)
+    {
+        if (! checkEngine(self))
+            return nullptr;
+
+        Engine& engine = *self->engine;
+        FlangerParameters::Snapshot values;
+
+        Py_BEGIN_ALLOW_THREADS
+        {
+            const std::lock_guard<std::mutex> lock(engine.mutex);
+            values = engine.values;
+        }
+        Py_END_ALLOW_THREADS
+
+        PyObject* dict = PyDict_New();
+
+        for (const auto& info : FlangerParameters::kTable)
+        {
+            PyObject* value = PyFloat_FromDouble(values.get(info.index));
+
+            if (dict == nullptr || value == nullptr || PyDict_SetItemString(dict, info.id, value) != 0)
+            {
+                Py_XDECREF(value);
+                Py_XDECREF(dict);
+                return nullptr;
+            }
+
+            Py_DECREF(value);
+        }
+
+        return dict;
+    }
+
+    PyObject* Flanger_reset(FlangerObject* self, PyObject*)
+    {
+        if (! checkEngine(self))
+            return nullptr;
+
+        Engine& engine = *self->engine;
+
+        Py_BEGIN_ALLOW_THREADS
+        {
+            const std::lock_guard<std::mutex> lock(engine.mutex);
+
+            for (auto& core : engine.cores)
+                core->reset();
+        }
+        Py_END_ALLOW_THREADS
+
+        Py_RETURN_NONE;
+    }
+
+    PyObject* Flanger_process(FlangerObject* self, PyObject* args, PyObject* kwargs)
+    {
+        static const char* keywords[] = { "input", "out", "params", nullptr };
+
+        PyObject* inputObject = nullptr;
+        PyObject* outputObject = Py_None;
+        PyObject* params = Py_None;
+
+        if (! PyArg_ParseTupleAndKeywords(args, kwargs, "O|OO", const_cast<char**>(keywords), &inputObject, &outputObject, &params)
+            || ! checkEngine(self))
+            return nullptr;
+
+        Engine& engine = *self->engine;
+        BufferView input;
+
+        if (! input.acquire(inputObject, false, "input"))
+            return nullptr;
+
+        // The shape as (batch, channels, samples), each channel contiguous
+        const int numDimensions = input.getNumDimensions();
+
+        if (numDimensions < 1 || numDimensions > 3 || input.getStride(numDimensions - 1) != input.view.itemsize)
+        {
+            PyErr_SetString(PyExc_ValueError, "input must be (samples,), (channels, samples) or (batch, channels, samples), "
+                                              "with the samples of each channel contiguous");
+            return nullptr;
+        }
+
+        const Py_ssize_t batchSize = numDimensions == 3 ? input.getSize(0) : 1;
+        const Py_ssize_t numChannels = numDimensions >= 2 ? input.getSize(numDimensions - 2) : 1;
+        const Py_ssize_t numSamples = input.getSize(numDimensions - 1);
+
+        if (numChannels > engine.numChannels || batchSize > (Py_ssize_t)engine.cores.size())
+        {
+            PyErr_Format(PyExc_ValueError, "input has %zd channels and a batch of %zd, this Flanger was made for %d and %zd",
+                         numChannels, batchSize, engine.numChannels, (Py_ssize_t)engine.cores.size());
+            return nullptr;
+        }
+
+        // No out: a new array like the input, from NumPy
+        PyObject* result = nullptr;
+
+        if (outputObject == Py_None)
+        {
+            PyObject* numpy = PyImport_ImportModule("numpy");
+
+            if (numpy == nullptr)
+            {
+                if (PyErr_ExceptionMatches(PyExc_ImportError))
+                {
+                    PyErr_Clear();
+                    PyErr_SetString(PyExc_ImportError, "process() needs NumPy to allocate its output: install it, or pass out=");
+                }
+
+                return nullptr;
+            }
+
+            result = PyObject_CallMethod(numpy, "empty_like", "O", inputObject);
+            Py_DECREF(numpy);
+        }
+        else
+        {
+            Py_INCREF(outputObject);
+            result = outputObject;
+        }
+
+        if (result == nullptr)
+            return nullptr;
+
+        BufferView output;
+
+        if (! output.acquire(result, true, "out"))
+        {
+            Py_DECREF(result);
+            return nullptr;
+        }
+
+        bool sameShape = output.getNumDimensions() == numDimensions && output.isDouble == input.isDouble
+                      && output.getStride(numDimensions - 1) == output.view.itemsize;
+
+        for (int dimension = 0; sameShape && dimension < numDimensions; ++dimension)
+            sameShape = output.getSize(dimension) == input.getSize(dimension);
+
+        if (! sameShape)
+        {
+            PyErr_SetString(PyExc_ValueError, "out must have the shape and the dtype of the input, with contiguous channels");
+            Py_DECREF(result);
+            return nullptr;
+        }
+
+        // Per-call parameters: numbers, or arrays of (samples,) or (batch, samples)
+        std::vector<std::pair<FlangerParameters::Index, float>> constants;
+        std::vector<ParameterSource> sources;
+
+        if (params != Py_None)
+        {
+            if (! PyDict_Check(params))
+            {
+                PyErr_SetString(PyExc_TypeError, "params must be a dict of parameter IDs to numbers or arrays");
+                Py_DECREF(result);
+                return nullptr;
+            }
+
+            PyObject *key, *value;
+            Py_ssize_t position = 0;
+
+            while (PyDict_Next(params, &position, &key, &value))
+            {
+                const auto* info = getInfo(key);
+
+                if (info == nullptr)
+                {
+                    Py_DECREF(result);
+                    return nullptr;
+                }
+
+                ParameterSource source { info->index, std::unique_ptr<BufferView>(new BufferView()) };
+                const bool isArray = PyObject_CheckBuffer(value) && source.values->acquire(value, false, info->id)
+                                  && source.values->getNumDimensions() > 0;
+
+                if (! isArray)
+                {
+                    float number = 0.0f;
+                    source.values->release();
+
+                    if (PyErr_Occurred() || ! getNumber(value, info->id, number))
+                    {
+                        Py_DECREF(result);
+                        return nullptr;
+                    }
+
+                    constants.emplace_back(info->index, FlangerParameters::constrain(*info, number));
+                    continue;
+                }
+
+                const int sourceDimensions = source.values->getNumDimensions();
+
+                if (sourceDimensions < 1 || sourceDimensions > 2 || source.values->getSize(sourceDimensions - 1) != numSamples
+                    || (sourceDimensions == 2 && source.values->getSize(0) != batchSize))
+                {
+                    PyErr_Format(PyExc_ValueError, "the values of %s must be (samples,) or (batch, samples)", info->id);
+                    Py_DECREF(result);
+                    return nullptr;
+                }
+
+                sources.push_back(std::move(source));
+            }
+        }
+
+        // Channel pointers of every item, taken while the buffers are known to be valid
+        const size_t numPointers = (size_t)(batchSize * numChannels);
+        std::vector<char*> inputChannels(numPointers), outputChannels(numPointers);
+
+        for (Py_ssize_t item = 0; item < batchSize; ++item)
+        {
+            for (Py_ssize_t channel = 0; channel < numChannels; ++channel)
+            {
+                Py_ssize_t inputOffset = 0, outputOffset = 0;
+
+                if (numDimensions == 3)
+                {
+                    inputOffset += item * input.getStride(0);
+                    outputOffset += item * output.getStride(0);
+                }
+
+                if (numDimensions >= 2)
+                {
+                    inputOffset += channel * input.getStride(numDimensions - 2);
+                    outputOffset += channel * output.getStride(numDimensions - 2);
+                }
+
+                inputChannels[(size_t)(item * numChannels + channel)] = input.getData() + inputOffset;
+                outputChannels[(size_t)(item * numChannels + channel)] = output.getData() + outputOffset;
+            }
+        }
+
+        const bool isDouble = input.isDouble;
+
+        Py_BEGIN_ALLOW_THREADS
+        {
+            const std::lock_guard<std::mutex> lock(engine.mutex);
+            const ScopedNoDenormals noDenormals;
+
+            // The per-call numbers apply to this call only
+            auto values = engine.values;
+
+            for (const auto& constant : constants)
+                values.values[(size_t)constant.first] = constant.second;
+
+            for (Py_ssize_t item = 0; item < batchSize; ++item)
+            {
+                auto& core = *engine.cores[(size_t)item];
+                char* const* in = inputChannels.data() + item * numChannels;
+                char* const* out = outputChannels.data() + item * numChannels;
+
+                if (isDouble)
+                    processItem<double>(engine, core, in, out, (int)numChannels, numSamples, item, values, sources);
+                else
+                    processItem<float>(engine, core, in, out, (int)numChannels, numSamples, item, values, sources);
+            }
+        }
+        Py_END_ALLOW_THREADS
+
+        return result;
+    }
+
+    //==============================================================================
+    PyObject* parameter_info(PyObject*, PyObject*)
+    {
+        PyObject* list = PyList_New(0);
+
+        for (const auto& info : FlangerParameters::kTable)
+        {
+            PyObject* choices = Py_None;
+            Py_INCREF(choices);
+
+            if (info.type == FlangerParameters::kChoice)
+            {
+                Py_DECREF(choices);
+                PyObject* text = PyUnicode_FromString(info.choices);
+                PyObject* separator = PyUnicode_FromString("|");
+                choices = text != nullptr && separator != nullptr ? PyUnicode_Split(text, separator, -1) : nullptr;
+                Py_XDECREF(text);
+                Py_XDECREF(separator);
+            }
+
+            static const char* const typeNames[] = { "float", "int", "choice" };
+            const float maximum = info.type == FlangerParameters::kChoice ? (float)(FlangerParameters::getNumChoices(info) - 1) : info.maximum;
+
+            PyObject* row = choices == nullptr ? nullptr
+                : Py_BuildValue("{s:s,s:s,s:s,s:f,s:f,s:f,s:N}",
+                                "id", info.id, "name", info.name, "type", typeNames[info.type],
+                                "minimum", (double)info.minimum, "maximum", (double)maximum,
+                                "default", (double)info.defaultValue, "choices", choices);
+
+            if (list == nullptr || row == nullptr || PyList_Append(list, row) != 0)
+            {
+                Py_XDECREF(row);
+                Py_XDECREF(list);
+                return nullptr;
+            }
+
+            Py_DECREF(row);
+        }
+
+        return list;
+    }
+
+    //==============================================================================
+    PyMethodDef flangerMethods[] =
+    {
+        { "process", asMethod(Flanger_process), METH_VARARGS | METH_KEYWORDS,
+          "process(input, out=None, params=None) -> out\n\n"
+          "Processes float32 or float64 samples shaped (samples,), (channels, samples) or (batch, channels, samples).\n"
+          "Without out, returns a new array like the input. params maps parameter IDs to numbers, or to arrays of\n"
+          "(samples,) or (batch, samples) read once per block, for this call only." },
+        { "set_parameters", asMethod(Flanger_set_parameters), METH_O,
+          "set_parameters(dict): sets parameters by ID, in the plugin's units, until changed again" },
+        { "get_parameters", asMethod(Flanger_get_parameters), METH_NOARGS,
+          "get_parameters() -> dict of every parameter ID to its value" },
+        { "reset", asMethod(Flanger_reset), METH_NOARGS,
+          "reset(): clears the delay lines and the LFOs, to start new streams" },
+        { nullptr, nullptr, 0, nullptr }
+    };
+
+    PyType_Slot flangerSlots[] =
+    {
+        { Py_tp_doc, const_cast<char*>("Flanger(sample_rate, channels=2, batch=1, block_size=128)\n\n"
+                                       "Up to batch independent streams of up to channels channels, processed in blocks of block_size.") },
+        { Py_tp_new, reinterpret_cast<void*>(PyType_GenericNew) },
+        { Py_tp_init, reinterpret_cast<void*>(Flanger_init) },
+        { Py_tp_dealloc, reinterpret_cast<void*>(Flanger_dealloc) },
+        { Py_tp_methods, flangerMethods },
+        { 0, nullptr }
+    };
+
+    PyType_Spec flangerSpec = { "flanger.Flanger", (int)sizeof(FlangerObject), 0, Py_TPFLAGS_DEFAULT, flangerSlots };
+
+    PyMethodDef moduleMethods[] =
+    {
+        { "parameter_info", parameter_info, METH_NOARGS,
+          "parameter_info() -> list of dicts: the ID, name, type, range, default and choices of every parameter" },
+        { nullptr, nullptr, 0, nullptr }
+    };
+
+    PyModuleDef flangerModule =
+    {
+        PyModuleDef_HEAD_INIT, "flanger",
+        "The Flanger plugin's DSP over NumPy arrays, with the plugin's parameter IDs and units.",
+        -1, moduleMethods, nullptr, nullptr, nullptr, nullptr
+    };
+}
+
+//==============================================================================
+PyMODINIT_FUNC PyInit_flanger()
+{
+    PyObject* module = PyModule_Create(&flangerModule);
+
+    if (module == nullptr)
+        return nullptr;
+
+    PyObject* type = PyType_FromSpec(&flangerSpec);
+
+    if (type == nullptr || PyModule_AddObject(module, "Flanger", type) < 0)
+    {
+        Py_XDECREF(type);
+        Py_DECREF(module);
+        return nullptr;
+    }
+
+    return module;
+}
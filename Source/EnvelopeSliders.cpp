@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    EnvelopeSliders.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "EnvelopeSliders.h"
+#include "PluginProcessor.h"
+
+//==============================================================================
+EnvelopeSliders::EnvelopeSliders(FlangerAudioProcessor& p): audioProcessor(p)
+{
+    // Rotary sliders, side by side, with their label above
+    auto setUpSlider = [this](juce::Slider& slider, juce::Label& label, const juce::String& text)
+    {
+        slider.setSliderStyle(juce::Slider::RotaryHorizontalVerticalDrag);
+        slider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 80, 20);
+
+        label.setText(text, juce::dontSendNotification);
+        label.setJustificationType(juce::Justification::centred);
+
+        addAndMakeVisible(slider);
+        addAndMakeVisible(label);
+    };
+
+    setUpSlider(toDelaySlider, toDelayLabel, "Env > Delay [ms]");
+    setUpSlider(toSweepSlider, toSweepLabel, "Env > Sweep");
+    setUpSlider(attackSlider, attackLabel, "Attack [ms]");
+    setUpSlider(releaseSlider, releaseLabel, "Release [ms]");
+
+    // Level detector
+    detectorSelector.addItem("Peak", 1);
+    detectorSelector.addItem("RMS", 2);
+    addAndMakeVisible(detectorSelector);
+
+    // Parameters
+    toDelayCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "ENV_DELAY", toDelaySlider);
+    toSweepCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "ENV_SWEEP", toSweepSlider);
+    attackCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "ENV_ATTACK", attackSlider);
+    releaseCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "ENV_RELEASE", releaseSlider);
+    detectorCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, "ENV_MODE", detectorSelector);
+}
+
+EnvelopeSliders::~EnvelopeSliders()
+{
+}
+
+void EnvelopeSliders::paint (juce::Graphics& g)
+{
+    g.fillAll (juce::Colours::dimgrey);   // clear the background
+
+    // Slider colors
+    getLookAndFeel().setColour(juce::Slider::thumbColourId, juce::Colours::pink);
+    getLookAndFeel().setColour(juce::Slider::rotarySliderFillColourId, juce::Colours::palevioletred);
+}
+
+void EnvelopeSliders::resized()
+{
+    // One column per slider, label on top; the columns must outlive performLayout()
+    juce::FlexBox columns[4];
+    juce::Slider* columnSliders[] = { &toDelaySlider, &toSweepSlider, &attackSlider, &releaseSlider };
+    juce::Label* columnLabels[] = { &toDelayLabel, &toSweepLabel, &attackLabel, &releaseLabel };
+
+    juce::FlexBox sliderFlex;
+    sliderFlex.flexWrap = juce::FlexBox::Wrap::noWrap;
+    sliderFlex.justifyContent = juce::FlexBox::JustifyContent::spaceAround;
+    sliderFlex.flexDirection = juce::FlexBox::Direction::row;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        columns[i].flexDirection = juce::FlexBox::Direction::column;
+        columns[i].items.add(juce::FlexItem(*columnLabels[i]).withMinHeight(20.0f).withMaxHeight(20.0f).withFlex(0, 0));
+        columns[i].items.add(juce::FlexItem(*columnSliders[i]).withMinHeight(60.0f).withFlex(1, 1));
+
+        sliderFlex.items.add(juce::FlexItem(columns[i]).withMinWidth(70.0f).withFlex(1, 1));
+    }
+
+    sliderFlex.items.add(juce::FlexItem(detectorSelector).withMinWidth(70.0f).withMaxHeight(30.0f).withFlex(1, 1)
+                             .withAlignSelf(juce::FlexItem::AlignSelf::center));
+
+    sliderFlex.performLayout(getLocalBounds().reduced(4, 4).toFloat());
+}
@@ -0,0 +1,56 @@
+/*
+  ==============================================================================
+
+    EnvelopeSliders.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/*
+    Controls of the envelope follower (auto-flange): how much the input level
+    moves the delay and scales the LFO sweep, and how fast it follows.
+*/
+class EnvelopeSliders  : public juce::Component
+{
+public:
+    EnvelopeSliders(FlangerAudioProcessor& p);
+    ~EnvelopeSliders() override;
+
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EnvelopeSliders)
+
+    FlangerAudioProcessor& audioProcessor;
+
+    juce::Slider toDelaySlider;
+    juce::Label toDelayLabel;
+
+    juce::Slider toSweepSlider;
+    juce::Label toSweepLabel;
+
+    juce::Slider attackSlider;
+    juce::Label attackLabel;
+
+    juce::Slider releaseSlider;
+    juce::Label releaseLabel;
+
+    juce::ComboBox detectorSelector;
+
+public:
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> toDelayCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> toSweepCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> attackCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> releaseCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> detectorCall;
+
+};
@@ -0,0 +1,255 @@
+/*
+  ==============================================================================
+
+    FlangerParameterTable.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    The plugin parameters, in one compile-time table, and their conversion to
+    the settings of FlangerCore. Free of JUCE, so that the tools built on the
+    core alone (the Python module) read the same IDs, ranges and units as the
+    plugin. FlangerParameters.h builds the JUCE layout from it.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../FlangerCore/FlangerCore.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace FlangerParameters
+{
+    // Index of each parameter in kTable, and in the host's parameter list. The first eight are the original
+    // parameters, at the indices that hosts and sessions addressing parameters by index expect: new ones go last.
+    enum Index
+    {
+        kSweep = 0,
+        kSpeed,
+        kDelay,
+        kFeedback,
+        kGain,
+        kWave,
+        kInterpol,
+        kPhase,
+        kRange,
+        kSlew,
+        kQuality,
+        kAdaptive,
+        kStorage,
+        kBarberpole,
+        kMidSide,
+        kSideFeedback,
+        kSideGain,
+        kModSource,
+        kEnvDelay,
+        kEnvSweep,
+        kEnvAttack,
+        kEnvRelease,
+        kEnvMode,
+        kMod1Source,
+        kMod1Target,
+        kMod1Depth,
+        kMod2Source,
+        kMod2Target,
+        kMod2Depth,
+        kMod3Source,
+        kMod3Target,
+        kMod3Depth,
+        kMod4Source,
+        kMod4Target,
+        kMod4Depth,
+        kLfo2Speed,
+        kLfo2Wave,
+        kModCc,
+        kChorusDelay,
+        kDoublerDelay,
+        kNumParameters
+    };
+
+    enum Type
+    {
+        kFloat = 0,     // AudioParameterFloat from minimum to maximum, with skew
+        kInt,           // AudioParameterInt from minimum to maximum
+        kChoice         // AudioParameterChoice between the '|'-separated choices, minimum and maximum unused
+    };
+
+    struct Info
+    {
+        Index index;
+        const char* id;
+        const char* name;
+        Type type;
+        float minimum;
+        float maximum;
+        float defaultValue;
+        float skew;
+        const char* choices;
+    };
+
+    // The IDs are saved in the sessions and used by the editor and OSC addresses: never change one
+    constexpr Info kTable[kNumParameters] =
+    {
+        { kSweep,        "SWEEP",       "Sweep",             kFloat,  0.0f,   1.0f,    1.0f,   1.0f, nullptr },
+        { kSpeed,        "SPEED",       "Speed",             kFloat,  0.0f,   10.0f,   1.0f,   1.0f, nullptr },
+        // The flange delay: the longer ranges read CHORUS_DLY or DOUBLER_DLY instead
+        { kDelay,        "DELAY",       "Delay",             kFloat,  5.0f,   25.0f,   15.0f,  1.0f, nullptr },
+        { kFeedback,     "FB",          "Feedback",          kFloat,  0.0f,   0.99f,   0.5f,   1.0f, nullptr },
+        { kGain,         "FF",          "Gain",              kFloat,  0.0f,   1.0f,    1.0f,   1.0f, nullptr },
+        { kWave,         "WAVE",        "Shape",             kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kSineWave|kTrWave|kSqWave|kSawWave|kRandomWave|kWavetableWave" },
+        { kInterpol,     "INTERPOL",    "Roughness",         kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kLinear|kQuadratic|kCubic" },
+        { kPhase,        "PHASE",       "Phase",             kInt,    0.0f,   1.0f,    0.0f,   1.0f, nullptr },
+        { kRange,        "RANGE",       "Range",             kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kFlangeRange|kChorusRange|kDoublerRange" },
+        { kSlew,         "SLEW",        "Random slew",       kFloat,  0.0f,   1.0f,    0.5f,   1.0f, nullptr },
+        { kQuality,      "QUALITY",     "Quality",           kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kHighQuality|kEcoQuality" },
+        { kAdaptive,     "ADAPTIVE",    "Adaptive quality",  kInt,    0.0f,   1.0f,    0.0f,   1.0f, nullptr },
+        { kStorage,      "STORAGE",     "Delay storage",     kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kFloatStorage|kCompactStorage" },
+        { kBarberpole,   "BARBERPOLE",  "Barberpole",        kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kBarberpoleOff|kBarberpoleRising|kBarberpoleFalling" },
+        { kMidSide,      "MID_SIDE",    "Mid/side",          kInt,    0.0f,   1.0f,    0.0f,   1.0f, nullptr },
+        { kSideFeedback, "SIDE_FB",     "Side feedback",     kFloat,  0.0f,   0.99f,   0.5f,   1.0f, nullptr },
+        { kSideGain,     "SIDE_FF",     "Side gain",         kFloat,  0.0f,   1.0f,    1.0f,   1.0f, nullptr },
+        { kModSource,    "MOD_SOURCE",  "Modulation",        kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kLfoSource|kSidechainSource|kSidechainEnvelopeSource" },
+        { kEnvDelay,     "ENV_DELAY",   "Envelope to delay", kFloat,  -10.0f, 10.0f,   0.0f,   1.0f, nullptr },
+        { kEnvSweep,     "ENV_SWEEP",   "Envelope to sweep", kFloat,  0.0f,   1.0f,    0.0f,   1.0f, nullptr },
+        { kEnvAttack,    "ENV_ATTACK",  "Envelope attack",   kFloat,  1.0f,   200.0f,  10.0f,  1.0f, nullptr },
+        { kEnvRelease,   "ENV_RELEASE", "Envelope release",  kFloat,  10.0f,  2000.0f, 200.0f, 1.0f, nullptr },
+        { kEnvMode,      "ENV_MODE",    "Envelope detector", kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kPeakDetector|kRmsDetector" },
+        // Modulation matrix: kNumModulationSlots rows of source, target and depth, then the sources' own settings
+        { kMod1Source,   "MOD1_SOURCE", "Mod 1 source",      kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kMatrixOff|kMatrixLfo|kMatrixLfo2|kMatrixEnvelope|kMatrixMidiCc|kMatrixRandom" },
+        { kMod1Target,   "MOD1_TARGET", "Mod 1 target",      kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kTargetDelay|kTargetSweep|kTargetFeedback|kTargetGain|kTargetSpeed|kTargetStereoPhase" },
+        { kMod1Depth,    "MOD1_DEPTH",  "Mod 1 depth",       kFloat,  -1.0f,  1.0f,    0.0f,   1.0f, nullptr },
+        { kMod2Source,   "MOD2_SOURCE", "Mod 2 source",      kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kMatrixOff|kMatrixLfo|kMatrixLfo2|kMatrixEnvelope|kMatrixMidiCc|kMatrixRandom" },
+        { kMod2Target,   "MOD2_TARGET", "Mod 2 target",      kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kTargetDelay|kTargetSweep|kTargetFeedback|kTargetGain|kTargetSpeed|kTargetStereoPhase" },
+        { kMod2Depth,    "MOD2_DEPTH",  "Mod 2 depth",       kFloat,  -1.0f,  1.0f,    0.0f,   1.0f, nullptr },
+        { kMod3Source,   "MOD3_SOURCE", "Mod 3 source",      kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kMatrixOff|kMatrixLfo|kMatrixLfo2|kMatrixEnvelope|kMatrixMidiCc|kMatrixRandom" },
+        { kMod3Target,   "MOD3_TARGET", "Mod 3 target",      kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kTargetDelay|kTargetSweep|kTargetFeedback|kTargetGain|kTargetSpeed|kTargetStereoPhase" },
+        { kMod3Depth,    "MOD3_DEPTH",  "Mod 3 depth",       kFloat,  -1.0f,  1.0f,    0.0f,   1.0f, nullptr },
+        { kMod4Source,   "MOD4_SOURCE", "Mod 4 source",      kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kMatrixOff|kMatrixLfo|kMatrixLfo2|kMatrixEnvelope|kMatrixMidiCc|kMatrixRandom" },
+        { kMod4Target,   "MOD4_TARGET", "Mod 4 target",      kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kTargetDelay|kTargetSweep|kTargetFeedback|kTargetGain|kTargetSpeed|kTargetStereoPhase" },
+        { kMod4Depth,    "MOD4_DEPTH",  "Mod 4 depth",       kFloat,  -1.0f,  1.0f,    0.0f,   1.0f, nullptr },
+        { kLfo2Speed,    "LFO2_SPEED",  "LFO 2 speed",       kFloat,  0.0f,   10.0f,   0.5f,   1.0f, nullptr },
+        { kLfo2Wave,     "LFO2_WAVE",   "LFO 2 shape",       kChoice, 0.0f,   0.0f,    0.0f,   1.0f, "kSineWave|kTrWave|kSqWave|kSawWave" },
+        { kModCc,        "MOD_CC",      "Mod MIDI CC",       kInt,    0.0f,   127.0f,  1.0f,   1.0f, nullptr },
+        // The delay of the chorus and doubler ranges, each over the base delays its lines hold
+        { kChorusDelay,  "CHORUS_DLY",  "Chorus delay",      kFloat,  5.0f,   50.0f,   25.0f,  1.0f, nullptr },
+        { kDoublerDelay, "DOUBLER_DLY", "Doubler delay",     kFloat,  5.0f,   100.0f,  60.0f,  1.0f, nullptr },
+    };
+
+    constexpr bool isTableInOrder(int i = 0)
+    {
+        return i == kNumParameters || (kTable[i].index == i && isTableInOrder(i + 1));
+    }
+
+    static_assert(isTableInOrder(), "kTable must list the parameters in the order of Index");
+    static_assert(kFeedback == 3 && kGain == 4 && kWave == 5 && kInterpol == 6 && kPhase == 7,
+                  "The original parameters keep their indices");
+    static_assert(kLfo2Speed - kMod1Source == 3 * flanger::kNumModulationSlots, "One source, target and depth per modulation slot");
+
+    inline const char* getID(Index index) noexcept { return kTable[index].id; }
+
+    // The delay parameter that a delay range (kFlangeRange...) reads
+    inline Index getDelayIndex(int delayRange) noexcept
+    {
+        return delayRange == flanger::kDoublerRange ? kDoublerDelay
+             : delayRange == flanger::kChorusRange ? kChorusDelay : kDelay;
+    }
+
+    // The row of kTable with this ID, or nullptr
+    inline const Info* findInfo(const char* id) noexcept
+    {
+        for (const auto& info : kTable)
+            if (std::strcmp(info.id, id) == 0)
+                return &info;
+
+        return nullptr;
+    }
+
+    inline int getNumChoices(const Info& info) noexcept
+    {
+        int numChoices = 1;
+
+        for (const char* c = info.choices; c != nullptr && *c != 0; ++c)
+            numChoices += *c == '|' ? 1 : 0;
+
+        return numChoices;
+    }
+
+    // A value as its parameter stores it: within the range, and rounded to a whole number unless kFloat
+    inline float constrain(const Info& info, float value) noexcept
+    {
+        if (info.type == kFloat)
+            return std::min(info.maximum, std::max(info.minimum, value));
+
+        const float maximum = info.type == kChoice ? (float)(getNumChoices(info) - 1) : info.maximum;
+        return std::min(maximum, std::max(info.minimum, std::round(value)));
+    }
+
+    //==============================================================================
+    // The values of all the parameters for one block, read in one pass. Aligned so the whole
+    // snapshot takes the fewest cache lines on the audio thread's stack.
+    struct alignas(64) Snapshot
+    {
+        std::array<float, kNumParameters> values;
+
+        float get(Index index) const noexcept { return values[(size_t)index]; }
+        int getInt(Index index) const noexcept { return (int)values[(size_t)index]; }
+        bool getBool(Index index) const noexcept { return values[(size_t)index] > 0.5f; }
+    };
+
+    // Every parameter at its default
+    inline Snapshot getDefaults() noexcept
+    {
+        Snapshot snapshot;
+
+        for (const auto& info : kTable)
+            snapshot.values[(size_t)info.index] = info.defaultValue;
+
+        return snapshot;
+    }
+
+    //==============================================================================
+    // The core settings for one block, converted to its units (seconds, indices) from the parameter values
+    inline flanger::Parameters toCoreParameters(const Snapshot& values) noexcept
+    {
+        flanger::Parameters params;
+        params.speed = values.get(kSpeed);
+        params.delay = values.get(getDelayIndex(values.getInt(kRange))) / 1000.0f; // delay in seconds
+        params.feedback = values.get(kFeedback);
+        params.sweep = values.get(kSweep) / 1000.0f * 5.0f; // sweep in seconds
+        params.gain = values.get(kGain);
+        params.interpol = values.getInt(kInterpol);
+        params.wave = values.getInt(kWave);
+        params.polarity = values.getInt(kPhase);
+        params.randomSlew = values.get(kSlew);
+        params.quality = values.getInt(kQuality);
+        params.modulationSource = values.getInt(kModSource);
+        params.barberpole = values.getInt(kBarberpole);
+        params.delayRange = values.getInt(kRange);
+        params.delayStorage = values.getInt(kStorage);
+        params.stereoMode = values.getInt(kMidSide);
+        params.sideGain = values.get(kSideGain);
+        params.sideFeedback = values.get(kSideFeedback);
+        params.envelopeToDelay = values.get(kEnvDelay) / 1000.0f; // seconds at full envelope
+        params.envelopeToSweep = values.get(kEnvSweep);
+        params.envelopeAttack = values.get(kEnvAttack) / 1000.0f;
+        params.envelopeRelease = values.get(kEnvRelease) / 1000.0f;
+        params.envelopeDetector = values.getInt(kEnvMode);
+
+        // The rows of each slot follow each other from kMod1Source on
+        for (int slot = 0; slot < flanger::kNumModulationSlots; ++slot)
+        {
+            const int row = kMod1Source + 3 * slot;
+            params.modulation[slot].source = values.getInt((Index)row);
+            params.modulation[slot].target = values.getInt((Index)(row + 1));
+            params.modulation[slot].depth = values.get((Index)(row + 2));
+        }
+
+        params.lfo2Speed = values.get(kLfo2Speed);
+        params.lfo2Wave = values.getInt(kLfo2Wave);
+        return params;
+    }
+}
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    FlangerParameters.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "FlangerParameters.h"
+
+namespace FlangerParameters
+{
+    juce::AudioProcessorValueTreeState::ParameterLayout createLayout()
+    {
+        std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
+
+        for (const auto& info : kTable)
+        {
+            switch (info.type)
+            {
+            case kFloat:
+                parameters.push_back(std::make_unique<juce::AudioParameterFloat>(info.id, info.name,
+                    juce::NormalisableRange<float>(info.minimum, info.maximum, 0.0f, info.skew), info.defaultValue));
+                break;
+            case kInt:
+                parameters.push_back(std::make_unique<juce::AudioParameterInt>(info.id, info.name,
+                    (int)info.minimum, (int)info.maximum, (int)info.defaultValue));
+                break;
+            case kChoice:
+                parameters.push_back(std::make_unique<juce::AudioParameterChoice>(info.id, info.name,
+                    juce::StringArray::fromTokens(info.choices, "|", {}), (int)info.defaultValue));
+                break;
+            default:
+                jassertfalse;
+                break;
+            }
+        }
+
+        return { parameters.begin(), parameters.end() };
+    }
+
+    //==============================================================================
+    Cache::Cache(juce::AudioProcessorValueTreeState& apvts)
+    {
+        for (const auto& info : kTable)
+        {
+            values[(size_t)info.index] = apvts.getRawParameterValue(info.id);
+
+            // Every row of kTable must be in the layout given to the APVTS
+            jassert(values[(size_t)info.index] != nullptr);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    FlangerParameters.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    The plugin parameters as JUCE sees them: the layout of the
+    AudioProcessorValueTreeState, built from kTable (FlangerParameterTable.h)
+    in its order, which is the order the hosts see; the audio thread reads
+    the values by index through pointers cached once, never by looking their
+    IDs up.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "FlangerParameterTable.h"
+
+#include <atomic>
+
+namespace FlangerParameters
+{
+    // One AudioParameter per row of kTable, in the same order
+    juce::AudioProcessorValueTreeState::ParameterLayout createLayout();
+
+    //==============================================================================
+    // The atomic values of the APVTS, looked up once by ID when the processor is built
+    class Cache
+    {
+    public:
+        explicit Cache(juce::AudioProcessorValueTreeState& apvts);
+
+        float get(Index index) const noexcept { return values[(size_t)index]->load(std::memory_order_relaxed); }
+
+        // Audio thread: every value, for one block
+        void fill(Snapshot& snapshot) const noexcept
+        {
+            for (size_t i = 0; i < values.size(); ++i)
+                snapshot.values[i] = values[i]->load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<float>*, kNumParameters> values;
+    };
+}
@@ -0,0 +1,19 @@
+/*
+  ==============================================================================
+
+    JuceHeader.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Stands in for the generated JuceHeader.h in the FlangerHeadless library:
+    only the modules the processor needs, none of the editor's or the plugin
+    client's. The plugin targets use the header JUCE generates for them.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_dsp/juce_dsp.h>
+#include <juce_osc/juce_osc.h>
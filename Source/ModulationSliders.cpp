@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    ModulationSliders.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "ModulationSliders.h"
+#include "PluginProcessor.h"
+
+//==============================================================================
+ModulationSliders::ModulationSliders(FlangerAudioProcessor& p): audioProcessor(p)
+{
+    // One row per slot: the items follow the order of MatrixSource and MatrixTarget
+    for (int i = 0; i < flanger::kNumModulationSlots; ++i)
+    {
+        auto& slot = slots[i];
+
+        slot.sourceSelector.addItemList({ "Off", "LFO", "LFO 2", "Envelope", "MIDI CC", "Random" }, 1);
+        slot.targetSelector.addItemList({ "Delay", "Sweep", "Feedback", "Gain", "Speed", "Stereo phase" }, 1);
+
+        slot.depthSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+        slot.depthSlider.setTextBoxStyle(juce::Slider::TextBoxRight, false, 60, 20);
+
+        addAndMakeVisible(slot.sourceSelector);
+        addAndMakeVisible(slot.targetSelector);
+        addAndMakeVisible(slot.depthSlider);
+
+        const juce::String prefix = "MOD" + juce::String(i + 1);
+        slot.sourceCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, prefix + "_SOURCE", slot.sourceSelector);
+        slot.targetCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, prefix + "_TARGET", slot.targetSelector);
+        slot.depthCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, prefix + "_DEPTH", slot.depthSlider);
+    }
+
+    // Rotary sliders with their label above, like the envelope controls
+    auto setUpSlider = [this](juce::Slider& slider, juce::Label& label, const juce::String& text)
+    {
+        slider.setSliderStyle(juce::Slider::RotaryHorizontalVerticalDrag);
+        slider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 80, 20);
+
+        label.setText(text, juce::dontSendNotification);
+        label.setJustificationType(juce::Justification::centred);
+
+        addAndMakeVisible(slider);
+        addAndMakeVisible(label);
+    };
+
+    setUpSlider(lfo2SpeedSlider, lfo2SpeedLabel, "LFO 2 [Hz]");
+    setUpSlider(ccSlider, ccLabel, "MIDI CC");
+
+    // Shape of the second LFO
+    lfo2WaveSelector.addItemList({ "Sine", "Triangle", "Square", "Saw" }, 1);
+    addAndMakeVisible(lfo2WaveSelector);
+
+    // Parameters
+    lfo2SpeedCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "LFO2_SPEED", lfo2SpeedSlider);
+    lfo2WaveCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, "LFO2_WAVE", lfo2WaveSelector);
+    ccCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "MOD_CC", ccSlider);
+}
+
+ModulationSliders::~ModulationSliders()
+{
+}
+
+void ModulationSliders::paint (juce::Graphics& g)
+{
+    g.fillAll (juce::Colours::dimgrey);   // clear the background
+
+    // Slider colors
+    getLookAndFeel().setColour(juce::Slider::thumbColourId, juce::Colours::pink);
+    getLookAndFeel().setColour(juce::Slider::rotarySliderFillColourId, juce::Colours::palevioletred);
+}
+
+void ModulationSliders::resized()
+{
+    // The slot rows on the left, the source settings in columns on the right; the boxes must outlive performLayout()
+    juce::FlexBox rows[flanger::kNumModulationSlots];
+    juce::FlexBox slotColumn;
+    slotColumn.flexDirection = juce::FlexBox::Direction::column;
+
+    for (int i = 0; i < flanger::kNumModulationSlots; ++i)
+    {
+        rows[i].flexDirection = juce::FlexBox::Direction::row;
+        rows[i].items.add(juce::FlexItem(slots[i].sourceSelector).withMinWidth(80.0f).withMargin(2.0f).withFlex(1, 1));
+        rows[i].items.add(juce::FlexItem(slots[i].targetSelector).withMinWidth(80.0f).withMargin(2.0f).withFlex(1, 1));
+        rows[i].items.add(juce::FlexItem(slots[i].depthSlider).withMinWidth(120.0f).withMargin(2.0f).withFlex(2, 1));
+
+        slotColumn.items.add(juce::FlexItem(rows[i]).withMinHeight(24.0f).withFlex(1, 1));
+    }
+
+    juce::FlexBox lfo2Column, ccColumn;
+    lfo2Column.flexDirection = juce::FlexBox::Direction::column;
+    lfo2Column.items.add(juce::FlexItem(lfo2SpeedLabel).withMinHeight(20.0f).withMaxHeight(20.0f).withFlex(0, 0));
+    lfo2Column.items.add(juce::FlexItem(lfo2SpeedSlider).withMinHeight(60.0f).withFlex(1, 1));
+    lfo2Column.items.add(juce::FlexItem(lfo2WaveSelector).withMinHeight(24.0f).withMaxHeight(24.0f).withFlex(0, 0));
+
+    ccColumn.flexDirection = juce::FlexBox::Direction::column;
+    ccColumn.items.add(juce::FlexItem(ccLabel).withMinHeight(20.0f).withMaxHeight(20.0f).withFlex(0, 0));
+    ccColumn.items.add(juce::FlexItem(ccSlider).withMinHeight(60.0f).withFlex(1, 1));
+
+    juce::FlexBox sliderFlex;
+    sliderFlex.flexWrap = juce::FlexBox::Wrap::noWrap;
+    sliderFlex.justifyContent = juce::FlexBox::JustifyContent::spaceAround;
+    sliderFlex.flexDirection = juce::FlexBox::Direction::row;
+
+    sliderFlex.items.add(juce::FlexItem(slotColumn).withMinWidth(300.0f).withFlex(3, 1));
+    sliderFlex.items.add(juce::FlexItem(lfo2Column).withMinWidth(70.0f).withFlex(1, 1));
+    sliderFlex.items.add(juce::FlexItem(ccColumn).withMinWidth(70.0f).withFlex(1, 1));
+
+    sliderFlex.performLayout(getLocalBounds().reduced(4, 4).toFloat());
+}
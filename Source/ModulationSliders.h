@@ -0,0 +1,63 @@
+/*
+  ==============================================================================
+
+    ModulationSliders.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/*
+    Controls of the modulation matrix: one row per slot with its source, its
+    target and its depth, and the settings of the second LFO and of the MIDI
+    controller the slots can read.
+*/
+class ModulationSliders  : public juce::Component
+{
+public:
+    ModulationSliders(FlangerAudioProcessor& p);
+    ~ModulationSliders() override;
+
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ModulationSliders)
+
+    FlangerAudioProcessor& audioProcessor;
+
+    // The controls of one slot of the matrix, attached to its "MODn_SOURCE", "MODn_TARGET" and "MODn_DEPTH"
+    struct Slot
+    {
+        juce::ComboBox sourceSelector;
+        juce::ComboBox targetSelector;
+        juce::Slider depthSlider;
+
+        std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> sourceCall;
+        std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> targetCall;
+        std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> depthCall;
+    };
+
+    Slot slots[flanger::kNumModulationSlots];
+
+    juce::Slider lfo2SpeedSlider;
+    juce::Label lfo2SpeedLabel;
+
+    juce::ComboBox lfo2WaveSelector;
+
+    juce::Slider ccSlider;
+    juce::Label ccLabel;
+
+public:
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> lfo2SpeedCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> lfo2WaveCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> ccCall;
+
+};
@@ -0,0 +1,138 @@
+/*
+  ==============================================================================
+
+    OscRemote.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "OscRemote.h"
+
+constexpr const char* OscRemote::kAddressPrefix;
+
+namespace
+{
+    // Addresses of the telemetry bundle, one float each
+    const char* const kInputPeakAddress = "/flanger/meter/input";       // linear peak since the last bundle
+    const char* const kOutputPeakAddress = "/flanger/meter/output";
+    const char* const kLfoPhaseAddress = "/flanger/lfo/phase";          // 0-1, after the last block
+}
+
+//==============================================================================
+OscRemote::OscRemote(juce::AudioProcessorValueTreeState& apvts)
+{
+    for (auto* parameter : apvts.processor.getParameters())
+    {
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(parameter))
+        {
+            parameterIndices.set(kAddressPrefix + ranged->paramID, parameters.size());
+            parameters.add(ranged);
+        }
+    }
+
+    receiver.addListener(this);
+}
+
+OscRemote::~OscRemote()
+{
+    stopTimer();
+    receiver.removeListener(this);
+    receiver.disconnect();
+    sender.disconnect();
+}
+
+bool OscRemote::applySettings(const Settings& newSettings)
+{
+    settings = newSettings;
+    bool opened = true;
+
+    receiver.disconnect();
+
+    if (settings.receive && ! receiver.connect(settings.receivePort))
+    {
+        settings.receive = false;
+        opened = false;
+    }
+
+    stopTimer();
+    sendingTelemetry = false;
+    sender.disconnect();
+
+    if (settings.send)
+    {
+        if (sender.connect(settings.sendHost, settings.sendPort))
+        {
+            sendingTelemetry = true;
+            startTimerHz(juce::jlimit(1, 100, settings.telemetryRate));
+        }
+        else
+        {
+            settings.send = false;
+            opened = false;
+        }
+    }
+
+    return opened;
+}
+
+//==============================================================================
+void OscRemote::oscMessageReceived(const juce::OSCMessage& message)
+{
+    const auto address = message.getAddressPattern().toString();
+    const int index = parameterIndices.contains(address) ? parameterIndices[address] : -1;
+
+    if (index < 0 || message.isEmpty() || ! (message[0].isFloat32() || message[0].isInt32()))
+    {
+        ++droppedMessages;
+        return;
+    }
+
+    const float value = message[0].isFloat32() ? message[0].getFloat32() : (float)message[0].getInt32();
+    auto* parameter = parameters.getUnchecked(index);
+
+    // One gesture per message, so the host records it like an edit with the mouse
+    parameter->beginChangeGesture();
+    parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+    parameter->endChangeGesture();
+}
+
+void OscRemote::oscBundleReceived(const juce::OSCBundle& bundle)
+{
+    for (const auto& element : bundle)
+    {
+        if (element.isMessage())
+            oscMessageReceived(element.getMessage());
+        else if (element.isBundle())
+            oscBundleReceived(element.getBundle());
+    }
+}
+
+//==============================================================================
+void OscRemote::raiseToPeak(std::atomic<float>& peak, float value) noexcept
+{
+    float current = peak.load(std::memory_order_relaxed);
+
+    while (value > current && ! peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void OscRemote::addBlockTelemetry(float newInputPeak, float newOutputPeak, float newLfoPhase) noexcept
+{
+    raiseToPeak(inputPeak, newInputPeak);
+    raiseToPeak(outputPeak, newOutputPeak);
+    lfoPhase.store(newLfoPhase, std::memory_order_relaxed);
+}
+
+void OscRemote::timerCallback()
+{
+    // The peaks restart from 0 for the next bundle: the meters show the loudest block since the last one
+    juce::OSCBundle bundle;
+    bundle.addElement(juce::OSCMessage(juce::OSCAddressPattern(kInputPeakAddress), inputPeak.exchange(0.0f)));
+    bundle.addElement(juce::OSCMessage(juce::OSCAddressPattern(kOutputPeakAddress), outputPeak.exchange(0.0f)));
+    bundle.addElement(juce::OSCMessage(juce::OSCAddressPattern(kLfoPhaseAddress), lfoPhase.load()));
+
+    sender.send(bundle);
+}
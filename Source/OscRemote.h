@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+
+    OscRemote.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Optional OSC remote control and telemetry, off by default.
+
+    Receiving: "/flanger/<PARAMETER_ID> <value>" sets a parameter, the value
+    being in the parameter's own units (e.g. "/flanger/DELAY 12.5" in ms).
+    The messages reach the message thread, which sets each parameter inside
+    a change gesture, as a mouse edit would: the host and the attachments of
+    the editor hear about it there, never on the audio thread, which reads
+    the new value from the next block on.
+
+    Sending: a bundle of peak meters and LFO state, telemetryRate times per
+    second, to a UDP endpoint (the addresses are listed in OscRemote.cpp). The
+    audio thread only updates atomics; a timer on the message thread sends.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <atomic>
+
+//==============================================================================
+class OscRemote  : private juce::OSCReceiver::Listener<juce::OSCReceiver::MessageLoopCallback>,
+                   private juce::Timer
+{
+public:
+    struct Settings
+    {
+        bool receive = false;
+        int receivePort = 9000;
+
+        bool send = false;
+        juce::String sendHost = "127.0.0.1";
+        int sendPort = 9001;
+        int telemetryRate = 30;     // bundles per second
+    };
+
+    explicit OscRemote(juce::AudioProcessorValueTreeState& apvts);
+    ~OscRemote() override;
+
+    // Message thread: opens or closes the sockets. Returns false if a socket could not be opened,
+    // in which case that direction stays off.
+    bool applySettings(const Settings& newSettings);
+    const Settings& getSettings() const noexcept { return settings; }
+
+    // Audio thread: whether the telemetry is on, so the caller can skip measuring the block
+    bool isSendingTelemetry() const noexcept { return sendingTelemetry.load(std::memory_order_relaxed); }
+
+    // Audio thread: the peaks of a block and the LFO phase after it
+    void addBlockTelemetry(float inputPeak, float outputPeak, float lfoPhase) noexcept;
+
+    // Messages addressed to no parameter, or without a number
+    int getNumDroppedMessages() const noexcept { return droppedMessages.load(std::memory_order_relaxed); }
+
+    static constexpr const char* kAddressPrefix = "/flanger/";
+
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OscRemote)
+
+    // Message thread
+    void oscMessageReceived(const juce::OSCMessage& message) override;
+    void oscBundleReceived(const juce::OSCBundle& bundle) override;
+
+    // Message thread: sends the telemetry bundle
+    void timerCallback() override;
+
+    static void raiseToPeak(std::atomic<float>& peak, float value) noexcept;
+
+    // Filled by the constructor, read-only afterwards
+    juce::Array<juce::RangedAudioParameter*> parameters;
+    juce::HashMap<juce::String, int> parameterIndices;
+
+    Settings settings;
+    juce::OSCReceiver receiver;
+    juce::OSCSender sender;
+
+    std::atomic<bool> sendingTelemetry { false };
+    std::atomic<float> inputPeak { 0.0f };
+    std::atomic<float> outputPeak { 0.0f };
+    std::atomic<float> lfoPhase { 0.0f };
+    std::atomic<int> droppedMessages { 0 };
+};
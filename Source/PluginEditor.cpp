@@ -9,15 +9,17 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "LFOSliders.h"
+#include "BinaryData.h"
 
 
 const int GUI_WIDTH = 800;
-const int GUI_HEIGHT = 720;
+const int GUI_HEIGHT = 980;
 float scaleUI = 1.0f;  // this can be 0.5, 0.666 or 1.0
 
 //==============================================================================
 FlangerAudioProcessorEditor::FlangerAudioProcessorEditor(FlangerAudioProcessor& p)
-    : AudioProcessorEditor(&p), audioProcessor(p), sliders(p)
+    : AudioProcessorEditor(&p), audioProcessor(p), sliders(p), envelopeSliders(p), modulationSliders(p), wavetableEditor(p),
+      spectrumDisplay(p.getSpectrumAnalyser())
 {
     // Logo
     auto img = juce::ImageCache::getFromMemory(BinaryData::logo_png, BinaryData::logo_pngSize);
@@ -50,19 +52,73 @@ FlangerAudioProcessorEditor::FlangerAudioProcessorEditor(FlangerAudioProcessor&
 
     addAndMakeVisible(fbSlider);
     addAndMakeVisible(fbLabel);
+
+    // Mix and feedback of the side component in mid/side mode, the main ones apply to the mid
+    sideGSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    sideGSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 100, 20);
+
+    sideGLabel.setText("Side mix", juce::dontSendNotification);
+
+    addAndMakeVisible(sideGSlider);
+    addAndMakeVisible(sideGLabel);
+
+    sideFbSlider.setSliderStyle(juce::Slider::LinearHorizontal);
+    sideFbSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 100, 20);
+
+    sideFbLabel.setText("Side feedback", juce::dontSendNotification);
+
+    addAndMakeVisible(sideFbSlider);
+    addAndMakeVisible(sideFbLabel);
     addAndMakeVisible(sliders);
+    addAndMakeVisible(envelopeSliders);
+    addAndMakeVisible(modulationSliders);
+    addAndMakeVisible(wavetableEditor);
+    addAndMakeVisible(spectrumDisplay);
 
     // LFO wave form selector
     waveSelector.addItem("Sine", 1);
     waveSelector.addItem("Triangular", 2);
     waveSelector.addItem("Square", 3);
     waveSelector.addItem("Saw", 4);
+    waveSelector.addItem("Random", 5);
+    waveSelector.addItem("Custom", 6);
 
     waveSelectorLabel.setText("LFO Type", juce::dontSendNotification);
 
     addAndMakeVisible(waveSelector);
     addAndMakeVisible(waveSelectorLabel);
 
+    // Modulation source selector: the LFO, or the sidechain input at audio rate
+    sourceSelector.addItem("LFO", 1);
+    sourceSelector.addItem("Sidechain", 2);
+    sourceSelector.addItem("Sidechain envelope", 3);
+
+    sourceSelectorLabel.setText("Modulation", juce::dontSendNotification);
+
+    addAndMakeVisible(sourceSelector);
+    addAndMakeVisible(sourceSelectorLabel);
+
+    // Barberpole selector: endless rising or falling sweep instead of the LFO
+    barberpoleSelector.addItem("Off", 1);
+    barberpoleSelector.addItem("Rising", 2);
+    barberpoleSelector.addItem("Falling", 3);
+
+    barberpoleSelectorLabel.setText("Barberpole", juce::dontSendNotification);
+
+    addAndMakeVisible(barberpoleSelector);
+    addAndMakeVisible(barberpoleSelectorLabel);
+
+    // Delay range selector: longer delay lines for chorus and doubling
+    rangeSelector.addItem("Flange (20 ms)", 1);
+    rangeSelector.addItem("Chorus (50 ms)", 2);
+    rangeSelector.addItem("Doubler (100 ms)", 3);
+
+    rangeSelectorLabel.setText("Range", juce::dontSendNotification);
+    rangeSelector.onChange = [this] { attachDelaySlider(); };
+
+    addAndMakeVisible(rangeSelector);
+    addAndMakeVisible(rangeSelectorLabel);
+
     // Interpolation selector
     interpolSelector.addItem("Linear", 1);
     interpolSelector.addItem("Quadratic", 2);
@@ -77,6 +133,46 @@ FlangerAudioProcessorEditor::FlangerAudioProcessorEditor(FlangerAudioProcessor&
     phaseSwitch.setButtonText("Invert phase");
     addAndMakeVisible(phaseSwitch);
 
+    // Mid/side switch: flanges mid and side instead of left and right
+    midSideSwitch.setButtonText("Mid/side");
+    addAndMakeVisible(midSideSwitch);
+
+    // Quality selector: Eco evaluates the LFO at control rate with linear taps, for dense sessions
+    qualitySelector.addItem("High", 1);
+    qualitySelector.addItem("Eco", 2);
+
+    qualitySelectorLabel.setText("Quality", juce::dontSendNotification);
+
+    addAndMakeVisible(qualitySelector);
+    addAndMakeVisible(qualitySelectorLabel);
+
+    // Adaptive quality: steps the quality down by itself when the processing gets close to the deadline
+    adaptiveSwitch.setButtonText("Adaptive quality");
+    addAndMakeVisible(adaptiveSwitch);
+
+    // Compact delay lines: 16-bit samples, half the memory, for sessions with many instances
+    compactSwitch.setButtonText("Compact delay lines");
+    addAndMakeVisible(compactSwitch);
+
+    // OSC remote: receives parameter changes and sends meters, "<receive port> > <host>:<send port>",
+    // double-click the endpoint to edit it
+    const auto& osc = audioProcessor.getOscSettings();
+    oscSwitch.setButtonText("OSC remote");
+    oscSwitch.setToggleState(osc.receive || osc.send, juce::dontSendNotification);
+    oscSwitch.onClick = [this] { updateOscSettings(); };
+    addAndMakeVisible(oscSwitch);
+
+    oscEndpointLabel.setFont(12.0f);
+    oscEndpointLabel.setEditable(false, true);
+    oscEndpointLabel.setText(juce::String(osc.receivePort) + " > " + osc.sendHost + ":" + juce::String(osc.sendPort),
+                             juce::dontSendNotification);
+    oscEndpointLabel.onTextChange = [this] { updateOscSettings(); };
+    addAndMakeVisible(oscEndpointLabel);
+
+    // DSP load, from the block profiler of the processor
+    dspLoadLabel.setFont(12.0f);
+    addAndMakeVisible(dspLoadLabel);
+    startTimerHz(4);
 
     // Window size
     // Resizable vertically and horizonally
@@ -89,10 +185,19 @@ FlangerAudioProcessorEditor::FlangerAudioProcessorEditor(FlangerAudioProcessor&
 
     waveSelectorCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, "WAVE", waveSelector);
     interpolSelectorCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, "INTERPOL", interpolSelector);
-    delayCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "DELAY", delaySlider);
+    rangeSelectorCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, "RANGE", rangeSelector);
+    barberpoleSelectorCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, "BARBERPOLE", barberpoleSelector);
+    sourceSelectorCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, "MOD_SOURCE", sourceSelector);
+    qualitySelectorCall = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.apvts, "QUALITY", qualitySelector);
+    attachDelaySlider();
     fbCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "FB", fbSlider);
     gCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "FF", gSlider);
+    sideFbCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "SIDE_FB", sideFbSlider);
+    sideGCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "SIDE_FF", sideGSlider);
+    midSideCall = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(audioProcessor.apvts, "MID_SIDE", midSideSwitch);
     phaseCall = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(audioProcessor.apvts, "PHASE", phaseSwitch);
+    adaptiveCall = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(audioProcessor.apvts, "ADAPTIVE", adaptiveSwitch);
+    compactCall = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(audioProcessor.apvts, "STORAGE", compactSwitch);
 
 
 }
@@ -101,6 +206,59 @@ FlangerAudioProcessorEditor::~FlangerAudioProcessorEditor()
 {
 }
 
+void FlangerAudioProcessorEditor::timerCallback()
+{
+    // Wavetables replaced by the custom LFO shape are deleted here, never on the audio thread
+    audioProcessor.collectGarbage();
+
+    const auto profile = audioProcessor.getBlockProfiler().getSnapshot();
+    juce::String text = "DSP " + juce::String(100.0 * profile.meanLoad, 1) + " % (worst "
+                      + juce::String(100.0 * profile.worstLoad, 1) + " %), "
+                      + juce::String((juce::int64)profile.numDeadlineMisses) + " late blocks";
+
+    if (adaptiveSwitch.getToggleState())
+        text << ", " << flanger::AdaptiveQuality::getLevelName(audioProcessor.getAdaptiveQuality().getLevel());
+
+    dspLoadLabel.setText(text, juce::dontSendNotification);
+}
+
+void FlangerAudioProcessorEditor::attachDelaySlider()
+{
+    // Each range has its own delay parameter, so the slider keeps its whole travel in every range
+    const auto index = FlangerParameters::getDelayIndex(rangeSelector.getSelectedItemIndex());
+    delayCall.reset();
+    delayCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, FlangerParameters::getID(index), delaySlider);
+}
+
+void FlangerAudioProcessorEditor::updateOscSettings()
+{
+    auto settings = audioProcessor.getOscSettings();
+    const auto text = oscEndpointLabel.getText();
+    const auto destination = text.fromFirstOccurrenceOf(">", false, false).trim();
+
+    // Anything that does not parse keeps the previous value
+    if (text.upToFirstOccurrenceOf(">", false, false).trim().getIntValue() > 0)
+        settings.receivePort = text.upToFirstOccurrenceOf(">", false, false).trim().getIntValue();
+
+    if (destination.containsChar(':'))
+    {
+        settings.sendHost = destination.upToLastOccurrenceOf(":", false, false).trim();
+
+        if (destination.fromLastOccurrenceOf(":", false, false).getIntValue() > 0)
+            settings.sendPort = destination.fromLastOccurrenceOf(":", false, false).getIntValue();
+    }
+
+    settings.receive = settings.send = oscSwitch.getToggleState();
+
+    if (! audioProcessor.setOscSettings(settings))
+        oscSwitch.setToggleState(audioProcessor.getOscSettings().receive || audioProcessor.getOscSettings().send,
+                                 juce::dontSendNotification);
+
+    const auto& applied = audioProcessor.getOscSettings();
+    oscEndpointLabel.setText(juce::String(applied.receivePort) + " > " + applied.sendHost + ":" + juce::String(applied.sendPort),
+                             juce::dontSendNotification);
+}
+
 //==============================================================================
 void FlangerAudioProcessorEditor::paint(juce::Graphics& g)
 {
@@ -140,8 +298,18 @@ void FlangerAudioProcessorEditor::resized()
 
     sliderFlex.items.add(juce::FlexItem(fbLabel).withMinHeight(50.0f).withMinWidth(50.0f).withMaxHeight(80.0f).withFlex(1, 1));
     sliderFlex.items.add(juce::FlexItem(fbSlider).withMinHeight(50.0f).withMinWidth(50.0f).withMaxHeight(50.0f).withFlex(1, 1));
+
+    sliderFlex.items.add(juce::FlexItem(sideGLabel).withMinHeight(50.0f).withMinWidth(50.0f).withMaxHeight(80.0f).withFlex(1, 1));
+    sliderFlex.items.add(juce::FlexItem(sideGSlider).withMinHeight(50.0f).withMinWidth(50.0f).withMaxHeight(50.0f).withFlex(1, 1));
+
+    sliderFlex.items.add(juce::FlexItem(sideFbLabel).withMinHeight(50.0f).withMinWidth(50.0f).withMaxHeight(80.0f).withFlex(1, 1));
+    sliderFlex.items.add(juce::FlexItem(sideFbSlider).withMinHeight(50.0f).withMinWidth(50.0f).withMaxHeight(50.0f).withFlex(1, 1));
     sliderFlex.performLayout(getLocalBounds().reduced(4, 4).toFloat());
     sliderFlex.items.add(juce::FlexItem(sliders).withFlex(2, 0));
+    sliderFlex.items.add(juce::FlexItem(envelopeSliders).withMinHeight(110.0f).withFlex(1, 0));
+    sliderFlex.items.add(juce::FlexItem(modulationSliders).withMinHeight(140.0f).withFlex(1, 0));
+    sliderFlex.items.add(juce::FlexItem(wavetableEditor).withMinHeight(110.0f).withFlex(1, 0));
+    sliderFlex.items.add(juce::FlexItem(spectrumDisplay).withMinHeight(110.0f).withFlex(1, 0));
 
     
     juce::FlexBox sideBar;
@@ -153,10 +321,28 @@ void FlangerAudioProcessorEditor::resized()
     sideBar.items.add(juce::FlexItem(waveSelectorLabel).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(0.5, 1));
     sideBar.items.add(juce::FlexItem(waveSelector).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(1, 1));
 
+    sideBar.items.add(juce::FlexItem(sourceSelectorLabel).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(0.5, 1));
+    sideBar.items.add(juce::FlexItem(sourceSelector).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(1, 1));
+
+    sideBar.items.add(juce::FlexItem(barberpoleSelectorLabel).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(0.5, 1));
+    sideBar.items.add(juce::FlexItem(barberpoleSelector).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(1, 1));
+
+    sideBar.items.add(juce::FlexItem(rangeSelectorLabel).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(0.5, 1));
+    sideBar.items.add(juce::FlexItem(rangeSelector).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(1, 1));
+
     sideBar.items.add(juce::FlexItem(interpolSelectorLabel).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(0.5, 1));
     sideBar.items.add(juce::FlexItem(interpolSelector).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(1, 1));
 
     sideBar.items.add(juce::FlexItem(phaseSwitch).withMinHeight(50.0f).withMinWidth(80.0f).withFlex(1, 1));
+    sideBar.items.add(juce::FlexItem(midSideSwitch).withMinHeight(50.0f).withMinWidth(80.0f).withFlex(1, 1));
+
+    sideBar.items.add(juce::FlexItem(qualitySelectorLabel).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(0.5, 1));
+    sideBar.items.add(juce::FlexItem(qualitySelector).withMinHeight(50.0f).withMinWidth(80.0f).withMaxHeight(50.0f).withFlex(1, 1));
+    sideBar.items.add(juce::FlexItem(adaptiveSwitch).withMinHeight(50.0f).withMinWidth(80.0f).withFlex(1, 1));
+    sideBar.items.add(juce::FlexItem(compactSwitch).withMinHeight(50.0f).withMinWidth(80.0f).withFlex(1, 1));
+    sideBar.items.add(juce::FlexItem(oscSwitch).withMinHeight(50.0f).withMinWidth(80.0f).withFlex(1, 1));
+    sideBar.items.add(juce::FlexItem(oscEndpointLabel).withMinHeight(40.0f).withMinWidth(80.0f).withFlex(1, 1));
+    sideBar.items.add(juce::FlexItem(dspLoadLabel).withMinHeight(40.0f).withMinWidth(80.0f).withFlex(1, 1));
     sideBar.items.add(juce::FlexItem(bottomSpace).withMinHeight(50.0f).withFlex(5, 1));
     
     juce::FlexBox imageHolder;
@@ -11,11 +11,16 @@
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
 #include "LFOSliders.h"
+#include "EnvelopeSliders.h"
+#include "ModulationSliders.h"
+#include "WavetableEditor.h"
+#include "SpectrumDisplay.h"
 
 //==============================================================================
 /**
 */
-class FlangerAudioProcessorEditor : public juce::AudioProcessorEditor
+class FlangerAudioProcessorEditor : public juce::AudioProcessorEditor,
+                                    private juce::Timer
 {
 public:
     FlangerAudioProcessorEditor(FlangerAudioProcessor&);
@@ -26,10 +31,23 @@ public:
     void resized() override;
 
 private:
+    // Refreshes the DSP load readout from the processor's block profiler
+    void timerCallback() override;
+
+    // Sends the OSC switch and endpoint to the processor, and shows the endpoint it ended up with
+    void updateOscSettings();
+
+    // Attaches the delay slider to the delay parameter of the selected range
+    void attachDelaySlider();
+
     // This reference is provided as a quick way for your editor to
     // access the processor object that created it.
     FlangerAudioProcessor& audioProcessor;
     LFOSliders sliders;
+    EnvelopeSliders envelopeSliders;
+    ModulationSliders modulationSliders;
+    WavetableEditor wavetableEditor;
+    SpectrumDisplay spectrumDisplay;
 
     juce::Slider delaySlider;
     juce::Label delayLabel;
@@ -43,22 +61,60 @@ private:
     juce::Slider gSlider;
     juce::Label gLabel;
 
+    juce::Slider sideFbSlider;
+    juce::Label sideFbLabel;
+
+    juce::Slider sideGSlider;
+    juce::Label sideGLabel;
+
     juce::ComboBox waveSelector;
     juce::Label waveSelectorLabel;
 
     juce::ComboBox interpolSelector;
     juce::Label interpolSelectorLabel;
 
+    juce::ComboBox sourceSelector;
+    juce::Label sourceSelectorLabel;
+
+    juce::ComboBox barberpoleSelector;
+    juce::Label barberpoleSelectorLabel;
+
+    juce::ComboBox rangeSelector;
+    juce::Label rangeSelectorLabel;
+
     juce::ToggleButton phaseSwitch;
 
+    juce::ToggleButton midSideSwitch;
+
+    juce::ComboBox qualitySelector;
+    juce::Label qualitySelectorLabel;
+
+    juce::ToggleButton adaptiveSwitch;
+
+    juce::ToggleButton compactSwitch;
+
+    juce::ToggleButton oscSwitch;
+    juce::Label oscEndpointLabel;
+
     juce::ImageComponent logo;
 
+    juce::Label dspLoadLabel;
+
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> waveSelectorCall;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> interpolSelectorCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> qualitySelectorCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> sourceSelectorCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> barberpoleSelectorCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> rangeSelectorCall;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> delayCall;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> fbCall;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> gCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sideFbCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sideGCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> midSideCall;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> phaseCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> adaptiveCall;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> compactCall;
 
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlangerAudioProcessorEditor)
@@ -5,10 +5,14 @@ This file contains the basic framework code for a JUCE plugin processor.
 */
 
 #include "PluginProcessor.h"
-#include "PluginEditor.h"
+#include "RealtimeSafety.h"
 
-const float FlangerAudioProcessor::kMaximumDelay = 0.02;
-const float FlangerAudioProcessor::kMaximumSweepWidth = 0.02;
+#if ! FLANGER_HEADLESS
+ #include "PluginEditor.h"
+#endif
+
+const float FlangerAudioProcessor::kMaximumDelay = flanger::FlangerCore::kMaximumDelay;
+const float FlangerAudioProcessor::kMaximumSweepWidth = flanger::FlangerCore::kMaximumSweepWidth;
 
 //==============================================================================
 FlangerAudioProcessor::FlangerAudioProcessor()
@@ -17,18 +21,26 @@ FlangerAudioProcessor::FlangerAudioProcessor()
 #if ! JucePlugin_IsMidiEffect
 #if ! JucePlugin_IsSynth
         .withInput("Input", juce::AudioChannelSet::stereo(), true)
+        // Optional external modulation source, see the "MOD_SOURCE" parameter
+        .withInput("Sidechain", juce::AudioChannelSet::stereo(), false)
 #endif
         .withOutput("Output", juce::AudioChannelSet::stereo(), true)
 #endif
-    ), apvts(*this, nullptr, "Parameters", createParameters())
+    ), apvts(*this, nullptr, "Parameters", FlangerParameters::createLayout())
 #endif
 {
-
+    updateWavetableFromState();
 }
 
 
 FlangerAudioProcessor::~FlangerAudioProcessor()
 {
+    // Headless profiling: when FLANGER_PROFILE_DUMP is an absolute path, each instance appends its profiler report
+    // to that file once, when it is destroyed (never from the hosts' state saves, which come at any time)
+    const auto dumpPath = juce::SystemStats::getEnvironmentVariable("FLANGER_PROFILE_DUMP", {});
+
+    if (juce::File::isAbsolutePath(dumpPath))
+        juce::File(dumpPath).appendText(getProfilerReport());
 }
 
 //==============================================================================
@@ -37,85 +49,6 @@ const juce::String FlangerAudioProcessor::getName() const
     return JucePlugin_Name;
 }
 
-int FlangerAudioProcessor::getNumParameters()
-{
-    return kNumParameters;
-}
-
-float FlangerAudioProcessor::getParameter(int index)
-{
-    switch (index)
-    {
-    case kDelayParam: return delay;
-    case kSweepParam: return sweep;
-    case kDepthParam: return g;
-    case kWetParam: return wet;
-    case kWaveParam: return wave;
-    case kInterpolParam: return interpol;
-    case kFbParam: return fb;
-    case kFrequencyParam: return speed;
-    case kStereoParam: return stereo;
-    default:return 0.0f;
-    }
-}
-
-void FlangerAudioProcessor::setParameter(int index, float newValue) {
-    switch (index)
-    {
-    case kDelayParam:
-        delay = newValue;
-        break;
-    case kSweepParam:
-        sweep = newValue;
-        break;
-    case kDepthParam:
-        g = newValue;
-        break;
-    case kFbParam:
-        fb = newValue;
-        break;
-    case kFrequencyParam:
-        speed = newValue;
-        break;
-    case kWaveParam:
-        wave = (int)newValue;
-        break;
-    case kInterpolParam:
-        interpol = (int)newValue;
-        break;
-    case kStereoParam:
-        stereo = (int)newValue;
-        break;
-    case kWetParam:
-        wet = (int)newValue;
-    default:
-        break;
-    }
-}
-
-
-const juce::String FlangerAudioProcessor::getParameterName(int index) {
-    switch (index)
-    {
-    case kDelayParam: return "delay";
-    case kSweepParam: return "sweep width";
-    case kDepthParam: return "depth";
-    case kFbParam: return "feedback";
-    case kFrequencyParam: return "frequency";
-    case kWaveParam: return "waveform";
-    case kInterpolParam: return "interpolation";
-    case kStereoParam: return "stereo";
-    case kWetParam: return "wet";
-    default: break;
-    }
-
-    return juce::String();
-}
-
-const juce::String FlangerAudioProcessor::getParameterText(int index) {
-    return juce::String(getParameter(index), 2);
-}
-
 const juce::String FlangerAudioProcessor::getInputChannelName(int channelIndex) const {
     return juce::String(channelIndex + 1);
 }
@@ -196,26 +129,13 @@ void FlangerAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
 {
     // Use this method as the place to do any pre-playback initialisation that you need..
 
-    // Here we get the delay buffer length (in samples): it's the number of samples of the maximum delay achievable by our effect.
-    
-    delayBufferLength = (int)((kMaximumDelay + kMaximumSweepWidth) * sampleRate);
-    
-    // Check to avoid zero-length
-    if (delayBufferLength < 1) {
-        delayBufferLength = 1;
-    }
-    
-    // Inizializing the delay buffer
-    delayBuffer.setSize(getTotalNumInputChannels(), delayBufferLength);
-    delayBuffer.clear();
-    
-    // Inizializing LFO-initial phase
-    lfoPhase = 0.0;
-    inverseSampleRate = 1.0 / sampleRate;
-
-    // Read and Write pointers initialized: we set delayBufferRead to "1" to avoid problems in retrieving the index of the read-pointer (see below)
-    delayBufferRead = 1;
-    delayBufferWrite = 0;
+    // The core sizes one delay buffer per input channel for the maximum delay achievable by our effect,
+    // and resets the LFO phase and the read/write pointers. Only the first call (or a larger block size or
+    // channel count) allocates: hosts call this on every reconfiguration, for every instance.
+    flangerCore.prepare(sampleRate, getMainBusNumInputChannels(), samplesPerBlock);
+    spectrumAnalyser.setSampleRate(sampleRate);
+    blockProfiler.prepare(sampleRate);
+    adaptiveQuality.reset();
 }
 
 void FlangerAudioProcessor::releaseResources()
@@ -224,6 +144,11 @@ void FlangerAudioProcessor::releaseResources()
     // spare memory, etc.
 }
 
+void FlangerAudioProcessor::reset()
+{
+    flangerCore.reset();
+}
+
 #ifndef JucePlugin_PreferredChannelConfigurations
 bool FlangerAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 {
@@ -243,6 +168,17 @@ bool FlangerAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) c
 #if ! JucePlugin_IsSynth
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
         return false;
+
+    // The sidechain, if the host enables it, is mono or stereo
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto sidechain = layouts.getChannelSet(true, 1);
+
+        if (! sidechain.isDisabled()
+            && sidechain != juce::AudioChannelSet::mono()
+            && sidechain != juce::AudioChannelSet::stereo())
+            return false;
+    }
 #endif
 
     return true;
@@ -252,235 +188,282 @@ bool FlangerAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) c
 
 void FlangerAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    // In test builds, reports any allocation or lock made while processing (see RealtimeSafety.h)
+    RealtimeSafety::ScopedAudioThread audioThreadCheck;
+    juce::ScopedNoDenormals noDenormals;
+
+    // The main bus only: the sidechain channels follow the main input ones in the buffer
+    auto numInputChannels = getMainBusNumInputChannels();
+    auto numOutputChannels = getMainBusNumOutputChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // All the parameter values in one pass over the cached pointers
+    FlangerParameters::Snapshot values;
+    parameterCache.fill(values);
+
+   #if FLANGER_BLOCK_PROFILER
+    // The adaptive quality follows the load of the previous block, then this one is timed (see FlangerProfiler.h)
+    const bool adaptive = values.getBool(FlangerParameters::kAdaptive);
+
+    if (adaptive)
+        adaptiveQuality.addBlockLoad(blockProfiler.getLastLoad());
 
-    auto numInputChannels = getTotalNumInputChannels();    
-    auto numOutputChannels = getTotalNumOutputChannels();  
-    const int numSamples = buffer.getNumSamples();          
+    const flanger::ScopedBlockTimer blockTimer(blockProfiler, numSamples);
+   #else
+    const bool adaptive = false;
+   #endif
 
-    // Declaration of dpw, dpr (delay pointer write, delay pointer read)
-    int channel, dpw; 
-    float ph;
-    float channel0EndPhase = lfoPhase;
-    
     // We decided to use the AudioProcessorValueTreeState class to retrieve the parameters of choice of the user, then processed by our plugin.
-    float speedP = apvts.getRawParameterValue("SPEED")->load();
-    float delayP = apvts.getRawParameterValue("DELAY")->load() / 1000.0f; // delay in seconds
-    float fbP = apvts.getRawParameterValue("FB")->load();
-    float sweepP = apvts.getRawParameterValue("SWEEP")->load() / 1000.0f * 5.0f; // sweep in seconds
-    float gP = apvts.getRawParameterValue("FF")->load();
-    int interpolP = apvts.getRawParameterValue("INTERPOL")->load();
-    int waveP = apvts.getRawParameterValue("WAVE")->load();
-    
-    int polarityP = apvts.getRawParameterValue("PHASE")->load();
-    int stereoP = stereo;
-
-    // Going through each channel of audio's passed in.
-
-    for (channel = 0; channel < numInputChannels; ++channel)
+    auto params = FlangerParameters::toCoreParameters(values);
+
+    if (adaptive)
+        params = adaptiveQuality.apply(params);
+
+    // The matrix reads the chosen controller at block rate: the last value the block received, or the previous one
+    const int controller = values.getInt(FlangerParameters::kModCc);
+
+    for (const auto metadata : midiMessages)
     {
-        // channelInData and channelOutData are two arrays of length numSamples which contain the audio to be processed
-        const float* channelInData = buffer.getReadPointer(channel);
-        float* channelOutData = buffer.getWritePointer(channel);
-
-        // delayData is the circular buffer, crucial to process the signal
-        float* delayData = delayBuffer.getWritePointer(channel);
-        
-        // Temporary copy of any state variables declared in the header (.h)
-
-        dpw = delayBufferWrite;
-        ph = lfoPhase;
-
-        // Signal processing, sample by sample through a for-cycle.
-
-        for (int i = 0; i < numSamples; ++i) {
-
-            const float in = channelInData[i];
-            float interpolatedSample = 0.0;
-
-            // Current delay time, at first inizialized and then retrieved as a function of the parameter "delayP" chose by the user plus the instantaneous 
-            // value of the LFO.
-            // The latter is defined as a function of the waveform chose by the user and it's implemented by a switch control.
-            
-            float currentDelay = 0.0f;
-            switch (waveP)
-            {
-            case kSineWave:
-            {
-                currentDelay = delayP + sweepP * ( 0.5f + 0.5f * sinf(2.0f * 3.14 * ph) );
-                break;
-            }
-
-            case kTrWave: {
-                if (ph < 0.25f)
-                    currentDelay = delayP + sweepP * (0.5f + 2.0f * ph);
-                else if (ph < 0.75f)
-                    currentDelay = delayP + sweepP * (1.0f - 2.0f * (ph - 0.25f));
-                else
-                    currentDelay = delayP + sweepP * (2.0f * (ph - 0.75f));
-                break;
-
-            }
-            case kSqWave: {
-                if (ph < 0.5f)
-                    currentDelay = delayP + sweepP * (1.0f);
-                else
-                    currentDelay = delayP + sweepP * (0.0f);
-                break;
-            }
-            case kSawWave: {
-                if (ph < 0.5f)
-                    currentDelay = delayP + sweepP * (0.5f + ph);
-                else
-                    currentDelay = delayP + sweepP * (ph - 0.5f);
-                break;
-            }
-
-            }
-            
-            // Retrieving the read pointer position with respect to the write pointer one (with 3 samples of headroom)
-            
-            float dpr = fmodf((float)dpw - (float)(currentDelay * getSampleRate()) + (float)delayBufferLength - 3, (float)delayBufferLength);
-            
-            // Check for non-zero dpr
-            if (dpr < 0)
-                dpr += delayBufferLength;
-            
-            // If the current read position is a non integer number, it's necessary to interpolate the fractional value by using three different
-            // algorithms: linear, quadratic, cubic. User can select among them through a combobox. Linear interpolation fits a line between
-            // the samples: quadratic fits a parabola and cubic a 3rd order polynomial.
-
-            if (interpol == kLinear) {
-
-                // Find the fraction by which the read pointer sits between two
-                // samples and use this to adjust weights of the samples
-                
-                float fraction = dpr - floorf(dpr);
-                int previousSample = (int)floorf(dpr);
-                int nextSample = (previousSample + 1) % delayBufferLength;
-                interpolatedSample = fraction * delayData[nextSample]
-                    + (1.0f - fraction) * delayData[previousSample];
-            }
-                // Find the peak of the parabola fitting the samples
-            
-            else if (interpol == kQuadratic) {
-                int sample1 = (int)floorf(dpr);
-                int sample2 = (sample1 + 1) % delayBufferLength;
-                int sample0 = (sample1 - 1 + delayBufferLength) % delayBufferLength;
-
-                float fraction = dpr - floorf(dpr);
-                float a0 = 0.5f * (delayData[sample0] - delayData[sample2]);
-                float a1 = 1 / (delayData[sample0] - 2.0f * delayData[sample1] + delayData[sample2]);
-                float a2 = a0 * a1;
-
-                interpolatedSample = delayData[sample1] - 0.25f * fraction * a2 * (delayData[sample0] - delayData[sample2]);
-            }
-            else if (interpol == kCubic) {
-
-                // Catmull-Rom variant of cubic interpolation:
-                
-                int sample1 = (int)floorf(dpr);
-                int sample2 = (sample1 + 1) % delayBufferLength;
-                int sample3 = (sample2 + 1) % delayBufferLength;
-                int sample0 = (sample1 - 1 + delayBufferLength) % delayBufferLength;
-
-                float fraction = dpr - floorf(dpr);
-                float frsq = fraction * fraction;
-
-                float a0 = -0.5f * delayData[sample0] + 1.5f * delayData[sample1]
-                    - 1.5f * delayData[sample2] + 0.5f * delayData[sample3];
-                float a1 = delayData[sample0] - 2.5f * delayData[sample1]
-                    + 2.0f * delayData[sample2] - 0.5f * delayData[sample3];
-                float a2 = -0.5f * delayData[sample0] + 0.5f * delayData[sample2];
-                float a3 = delayData[sample1];
-
-                interpolatedSample = a0 * fraction * frsq + a1 * frsq + a2 * fraction + a3;
-
-            }
-
-
-            // Store the current information in the delay buffer. 
-
-            delayData[dpw] = in + (interpolatedSample * fbP);
-
-            // Increment the write pointer at a constant rate. The read pointer will move at different
-            // rates depending on the settings of the LFO, the delay and the sweep width.
-
-            if (++dpw >= delayBufferLength)
-                dpw = 0;
-
-            // Store the output sample in the buffer, replacing the input
-            if (polarityP == 0) channelOutData[i] = in + gP * interpolatedSample * 1;
-            else if (polarityP == 1) channelOutData[i] = in + gP * interpolatedSample * (-1);
-
-            // Update the LFO phase, normalizing its value in the range 0-1
-            ph += speedP * inverseSampleRate;
-
-            if (ph >= 1.0)
-                ph -= 1.0;
-        }
-
-        // Use channel 0 only to keep the phase in sync between calls to processBlock()
-        // Otherwise quadrature phase on multiple channels will create problems.
-        if (channel == 0)
-            channel0EndPhase = ph;
+        const auto message = metadata.getMessage();
+
+        if (message.isControllerOfType(controller))
+            midiControllerValue = (float)message.getControllerValue() / 127.0f;
     }
 
-   // Push back the temporary copy of the state variables
-    lfoPhase = channel0EndPhase;
-    delayBufferWrite = dpw;
+    params.midiCc = midiControllerValue;
+
+    // The core reads the sidechain channels where the host put them, without copying
+    const float* const* sidechain = nullptr;
+    int numSidechainChannels = getBusCount(true) > 1 ? getChannelCountOfBus(true, 1) : 0;
+
+    if (numSidechainChannels > 0)
+    {
+        const int firstSidechainChannel = getChannelIndexInProcessBlockBuffer(true, 1, 0);
+        numSidechainChannels = juce::jmin(numSidechainChannels, buffer.getNumChannels() - firstSidechainChannel);
+        sidechain = buffer.getArrayOfReadPointers() + firstSidechainChannel;
+    }
+
+    const int numMainChannels = juce::jmin(numInputChannels, buffer.getNumChannels());
+
+    // Peak of the main channels, for the OSC meters
+    auto getPeak = [&]()
+    {
+        float peak = 0.0f;
+
+        for (int channel = 0; channel < numMainChannels; ++channel)
+            peak = juce::jmax(peak, buffer.getMagnitude(channel, 0, numSamples));
+
+        return peak;
+    };
+
+    const bool telemetry = oscRemote.isSendingTelemetry();
+    const float inputPeak = telemetry ? getPeak() : 0.0f;
+
+    // The core processes the input channels in place
+    flangerCore.process(buffer.getArrayOfReadPointers(), buffer.getArrayOfWritePointers(),
+                        numMainChannels, numSamples, params, sidechain, numSidechainChannels);
+
+    if (telemetry)
+        oscRemote.addBlockTelemetry(inputPeak, getPeak(), flangerCore.getLfoPhase());
+
+    // Copies the output for the spectrum display, if it is open
+    spectrumAnalyser.pushSamples(buffer.getArrayOfReadPointers(), numMainChannels, numSamples);
+    spectrumAnalyser.setCombParameters(params.delay, params.feedback, params.polarity == 1 ? -params.gain : params.gain);
 
     // Clearing any output channels with no input data.
-    
     for (auto i = numInputChannels; i < numOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
+}
+
+void FlangerAudioProcessor::processBlockBypassed(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+{
+    RealtimeSafety::ScopedAudioThread audioThreadCheck;
+
+    auto numInputChannels = getMainBusNumInputChannels();
+    auto numOutputChannels = getMainBusNumOutputChannels();
 
+    // Only the LFO and the delay line format follow the parameters while bypassed
+    flanger::Parameters params;
+    params.speed = parameterCache.get(FlangerParameters::kSpeed);
+    params.wave = (int)parameterCache.get(FlangerParameters::kWave);
+    params.delayRange = (int)parameterCache.get(FlangerParameters::kRange);
+    params.delayStorage = (int)parameterCache.get(FlangerParameters::kStorage);
+
+    flangerCore.processBypassed(buffer.getArrayOfReadPointers(), buffer.getArrayOfWritePointers(),
+                                juce::jmin(numInputChannels, buffer.getNumChannels()), buffer.getNumSamples(), params);
+
+    for (auto i = numInputChannels; i < numOutputChannels; ++i)
+        buffer.clear(i, 0, buffer.getNumSamples());
+}
+
+//==============================================================================
+juce::String FlangerAudioProcessor::getProfilerReport() const
+{
+    const auto snapshot = blockProfiler.getSnapshot();
+    juce::String report;
+
+    report << "Flanger block profile: " << (juce::int64)snapshot.numBlocks << " blocks, mean load "
+           << juce::String(100.0 * snapshot.meanLoad, 2) << " %, worst " << juce::String(100.0 * snapshot.worstLoad, 2)
+           << " %, " << (juce::int64)snapshot.numDeadlineMisses << " deadline misses" << juce::newLine;
+
+    const auto quality = adaptiveQuality.getState();
+
+    report << "Adaptive quality: " << flanger::AdaptiveQuality::getLevelName(quality.level) << ", smoothed load "
+           << juce::String(100.0 * quality.smoothedLoad, 2) << " %, " << (juce::int64)quality.numStepsDown << " steps down, "
+           << (juce::int64)quality.numStepsUp << " steps up" << juce::newLine;
+
+    // Histogram of the block durations, one row per non-empty bin
+    const int binWidth = 100 / flanger::BlockProfiler::kBinsPerDeadline;
+
+    for (int bin = 0; bin < flanger::BlockProfiler::kNumBins; ++bin)
+    {
+        if (snapshot.bins[bin] == 0)
+            continue;
+
+        const bool isLastBin = bin == flanger::BlockProfiler::kNumBins - 1;
+        const juce::String range = isLastBin ? ">= " + juce::String(bin * binWidth) + " %"
+                                             : juce::String(bin * binWidth) + " - " + juce::String((bin + 1) * binWidth) + " %";
+
+        report << "  " << range.paddedRight(' ', 14) << juce::String((juce::int64)snapshot.bins[bin]).paddedLeft(' ', 10)
+               << juce::newLine;
+    }
+
+   #if FLANGER_TRACE_STAGES
+    juce::uint64 totalStageCycles = 0;
+
+    for (int stage = 0; stage < flanger::kNumStages; ++stage)
+        totalStageCycles += flangerCore.getStageCycles(stage);
+
+    for (int stage = 0; stage < flanger::kNumStages; ++stage)
+    {
+        const auto cycles = flangerCore.getStageCycles(stage);
+        report << "  stage " << juce::String(flanger::getStageName(stage)).paddedRight(' ', 14)
+               << juce::String((juce::int64)cycles).paddedLeft(' ', 16) << " cycles"
+               << (totalStageCycles > 0 ? " (" + juce::String(100.0 * (double)cycles / (double)totalStageCycles, 1) + " %)" : juce::String())
+               << juce::newLine;
+    }
+   #endif
+
+    return report;
 }
 
 //==============================================================================
 bool FlangerAudioProcessor::hasEditor() const
 {
-    return true; // (change this to false if you choose to not supply an editor)
+    return ! FLANGER_HEADLESS; // (change this to false if you choose to not supply an editor)
 }
 
 juce::AudioProcessorEditor* FlangerAudioProcessor::createEditor()
 {
+   #if FLANGER_HEADLESS
+    return nullptr;
+   #else
     return new FlangerAudioProcessorEditor(*this);
+   #endif
 }
 
 //==============================================================================
 void FlangerAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    // You should use this method to store your parameters in the memory block.
-    // You could do that either as raw data, or use the XML or ValueTree classes
-    // as intermediaries to make it easy to save and load complex data.
+    // The parameters are stored as the XML of the AudioProcessorValueTreeState
+    auto state = apvts.copyState();
+    std::unique_ptr<juce::XmlElement> xml(state.createXml());
+    copyXmlToBinary(*xml, destData);
 }
 
 void FlangerAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
-    // You should use this method to restore your parameters from this memory block,
-    // whose contents will have been created by the getStateInformation() call.
+    // Restore the parameters from the memory block created by getStateInformation(), ignoring anything else
+    std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
+
+    if (xmlState != nullptr && xmlState->hasTagName(apvts.state.getType()))
+    {
+        apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
+        updateWavetableFromState();
+        updateOscFromState();
+    }
 }
 
 //==============================================================================
-// This creates new instances of the plugin..
-juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+// The OSC settings are a child of the state tree, so a session reopens its sockets when it is loaded
+static const juce::Identifier oscId("OSC");
+
+bool FlangerAudioProcessor::setOscSettings(const OscRemote::Settings& settings)
 {
-    return new FlangerAudioProcessor();
+    auto osc = apvts.state.getOrCreateChildWithName(oscId, nullptr);
+    osc.setProperty("receive", settings.receive, nullptr);
+    osc.setProperty("receivePort", settings.receivePort, nullptr);
+    osc.setProperty("send", settings.send, nullptr);
+    osc.setProperty("sendHost", settings.sendHost, nullptr);
+    osc.setProperty("sendPort", settings.sendPort, nullptr);
+    osc.setProperty("telemetryRate", settings.telemetryRate, nullptr);
+
+    return oscRemote.applySettings(settings);
+}
+
+void FlangerAudioProcessor::updateOscFromState()
+{
+    const auto osc = apvts.state.getChildWithName(oscId);
+    OscRemote::Settings settings;
+
+    if (osc.isValid())
+    {
+        settings.receive = osc.getProperty("receive", settings.receive);
+        settings.receivePort = osc.getProperty("receivePort", settings.receivePort);
+        settings.send = osc.getProperty("send", settings.send);
+        settings.sendHost = osc.getProperty("sendHost", settings.sendHost).toString();
+        settings.sendPort = osc.getProperty("sendPort", settings.sendPort);
+        settings.telemetryRate = osc.getProperty("telemetryRate", settings.telemetryRate);
+    }
+
+    oscRemote.applySettings(settings);
+}
+
+//==============================================================================
+// The wavetable points are a property of the state tree, so they are saved and restored with the parameters
+static const juce::Identifier wavetablePointsId("WAVETABLE_POINTS");
+
+juce::Array<float> FlangerAudioProcessor::getWavetablePoints() const
+{
+    juce::Array<float> points;
+    juce::StringArray tokens;
+    tokens.addTokens(apvts.state.getProperty(wavetablePointsId).toString(), " ", {});
+
+    for (const auto& token : tokens)
+        points.add(juce::jlimit(0.0f, 1.0f, token.getFloatValue()));
+
+    // Default shape, and fallback for a malformed state: one period of a sine
+    if (points.size() != kNumWavetablePoints)
+    {
+        points.clearQuick();
+
+        for (int i = 0; i < kNumWavetablePoints; ++i)
+            points.add(0.5f + 0.5f * std::sin(juce::MathConstants<float>::twoPi * (float)i / (float)kNumWavetablePoints));
+    }
+
+    return points;
 }
 
-juce::AudioProcessorValueTreeState::ParameterLayout FlangerAudioProcessor::createParameters()
+void FlangerAudioProcessor::setWavetablePoints(const juce::Array<float>& points)
 {
+    juce::StringArray tokens;
+
+    for (auto point : points)
+        tokens.add(juce::String(juce::jlimit(0.0f, 1.0f, point), 4));
 
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> parameters;
+    apvts.state.setProperty(wavetablePointsId, tokens.joinIntoString(" "), nullptr);
+    updateWavetableFromState();
+}
 
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>("SWEEP", "Sweep", 0.0f, 1.0f, 1.0f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>("SPEED", "Speed", 0.0f, 10.0f, 1.0f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>("DELAY", "Delay", 5.0f, 25.0f, 15.0f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>("FB", "Feedback", 0.0f, 0.99f, 0.5f));
-    parameters.push_back(std::make_unique<juce::AudioParameterFloat>("FF", "Gain", 0.0f, 1.0f, 1.0f));
-    parameters.push_back(std::make_unique<juce::AudioParameterChoice>("WAVE", "Shape", juce::StringArray( "kSineWave", "kTrWave", "kSqWave", "kSawWave"), kSineWave));
-    parameters.push_back(std::make_unique<juce::AudioParameterChoice>("INTERPOL", "Roughness", juce::StringArray( "kLinear", "kQuadratic", "kCubic" ), kLinear));
-    parameters.push_back(std::make_unique<juce::AudioParameterInt>("PHASE", "Phase", 0, 1, 0));
+void FlangerAudioProcessor::updateWavetableFromState()
+{
+    const auto points = getWavetablePoints();
+    flangerCore.setWavetable(flanger::Wavetable::fromPoints(points.getRawDataPointer(), points.size()));
+}
 
-    return { parameters.begin(), parameters.end() };
+//==============================================================================
+// This creates new instances of the plugin..
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+{
+    return new FlangerAudioProcessor();
 }
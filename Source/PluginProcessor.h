@@ -8,7 +8,18 @@
 
 #pragma once
 
+// Set by the FlangerHeadless library: no editor, and none of its modules
+#ifndef FLANGER_HEADLESS
+ #define FLANGER_HEADLESS 0
+#endif
+
 #include <JuceHeader.h>
+#include "../FlangerCore/FlangerCore.h"
+#include "../FlangerCore/FlangerProfiler.h"
+#include "../FlangerCore/FlangerAdaptiveQuality.h"
+#include "FlangerParameters.h"
+#include "OscRemote.h"
+#include "SpectrumAnalyser.h"
 
 //==============================================================================
 /**
@@ -24,12 +35,18 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
 
+    // Transport jumps: clears the delay lines and the LFO without reallocating, much cheaper than prepareToPlay()
+    void reset() override;
+
 #ifndef JucePlugin_PreferredChannelConfigurations
     bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
 #endif
 
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
 
+    // Passes the input through while keeping the delay lines and the LFO running, so un-bypassing doesn't click
+    void processBlockBypassed(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override;
@@ -37,8 +54,6 @@ public:
     //==============================================================================
     const juce::String getName() const override;
 
-    int getNumParameters();
-
     bool acceptsMidi() const override;
     bool producesMidi() const override;
     bool isMidiEffect() const override;
@@ -55,16 +70,42 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // Heap memory of the delay lines, for memory budgeting across many instances
+    size_t getDelayBufferBytes() const noexcept { return flangerCore.getDelayBufferBytes(); }
+
+    // Block durations against the buffer deadline, readable from any thread
+    const flanger::BlockProfiler& getBlockProfiler() const noexcept { return blockProfiler; }
+
+    // Points of the user-drawn LFO shape (kWavetableWave), values 0-1 over one period. Message thread only:
+    // setting them stores them in the plugin state and hands a new table to the audio thread.
+    static constexpr int kNumWavetablePoints = 32;
+    juce::Array<float> getWavetablePoints() const;
+    void setWavetablePoints(const juce::Array<float>& points);
+
+    // Deletes the wavetables the audio thread no longer uses; call it regularly from the message thread
+    void collectGarbage() { flangerCore.collectGarbage(); }
+
+    // Level and transition counts of the adaptive quality governor, readable from any thread
+    const flanger::AdaptiveQuality& getAdaptiveQuality() const noexcept { return adaptiveQuality; }
+
+    // Output spectrum and comb response for the editor, computed on its own thread while the editor is open
+    SpectrumAnalyser& getSpectrumAnalyser() noexcept { return spectrumAnalyser; }
+
+    // OSC remote control and telemetry, off by default. Message thread only: setting them stores them in the
+    // plugin state and opens or closes the sockets; returns false if a port could not be opened.
+    const OscRemote::Settings& getOscSettings() const noexcept { return oscRemote.getSettings(); }
+    bool setOscSettings(const OscRemote::Settings& settings);
+    int getNumDroppedOscMessages() const noexcept { return oscRemote.getNumDroppedMessages(); }
+
+    // Human-readable dump of the block profiler, the adaptive quality and the stage traces, if compiled in
+    juce::String getProfilerReport() const;
+
     static const float kMaximumDelay;
     static const float kMaximumSweepWidth;
 
     juce::AudioProcessorValueTreeState apvts;
 
     // Declaration of function 
-    float getParameter(int index);
-    void setParameter(int index, float newValue);
-    const juce::String getParameterName(int index);
-    const juce::String getParameterText(int index);
     const juce::String getInputChannelName(int channelIndex) const;
     const juce::String getOutputChannelName(int channelIndex) const;
     bool isInputChannelStereoPair(int index) const;
@@ -77,57 +118,27 @@ private:
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlangerAudioProcessor)
 
-    juce::AudioProcessorValueTreeState::ParameterLayout createParameters();
-
-    // Variables for the delay circular buffer: length, actual circular buffer, read and write pointers
-    int delayBufferLength;
-    juce::AudioSampleBuffer delayBuffer;
-    int delayBufferRead;
-    int delayBufferWrite;
-
-    enum Parameters
-    {
-
-        kDelayParam = 0,
-        kSweepParam,
-        kDepthParam,
-        kWetParam,
-        kWaveParam,
-        kInterpolParam,
-        kFbParam,
-        kFrequencyParam,
-        kStereoParam,
-        kNumParameters
-    };
-
-    enum Waves
-    {
-        kSineWave = 0,
-        kTrWave = 1,
-        kSqWave = 2,
-        kSawWave = 3
-    };
-
-    enum Interpol
-    {
-        kLinear = 0,
-        kQuadratic = 1,
-        kCubic = 2
-    };
-
-    float lfoPhase;
-    double inverseSampleRate;
-
-    // Variables for the flanger parameters
-    float delay;
-    float wet;
-    float fb;
-    float sweep;
-    float g;
-    float speed; // frequency
-    float time;
-    int polarity;
-    int interpol;
-    int wave;
-    int stereo;
+    // Sends the wavetable stored in the state to the core, or the default shape if there is none
+    void updateWavetableFromState();
+
+    // Applies the OSC settings stored in the state, or turns OSC off if there are none
+    void updateOscFromState();
+
+    // Pointers to the parameter values, looked up once: processBlock reads them by index
+    FlangerParameters::Cache parameterCache { apvts };
+
+    // All the signal processing is done by the JUCE-independent core: the processor only feeds it the parameters
+    flanger::FlangerCore flangerCore;
+
+    // Last value (0-1) of the MIDI controller chosen by "MOD_CC", the kMatrixMidiCc source; audio thread only
+    float midiControllerValue = 0.0f;
+
+    flanger::BlockProfiler blockProfiler;
+
+    // Degrades the quality when the blocks get close to their deadline, if "ADAPTIVE" is on
+    flanger::AdaptiveQuality adaptiveQuality;
+
+    OscRemote oscRemote { apvts };
+
+    SpectrumAnalyser spectrumAnalyser;
 };
\ No newline at end of file
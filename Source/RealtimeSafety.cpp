@@ -0,0 +1,296 @@
+/*
+  ==============================================================================
+
+    RealtimeSafety.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "RealtimeSafety.h"
+
+#if FLANGER_RT_SAFETY_CHECKS
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#if JUCE_LINUX
+ #include <dlfcn.h>
+ #include <pthread.h>
+ #include <time.h>
+
+ extern "C" void* __libc_malloc(size_t);
+ extern "C" void* __libc_calloc(size_t, size_t);
+ extern "C" void* __libc_realloc(void*, size_t);
+ extern "C" void* __libc_memalign(size_t, size_t);
+ extern "C" void __libc_free(void*);
+#elif JUCE_WINDOWS
+ #include <malloc.h>
+#endif
+
+namespace
+{
+    // Plain thread-locals: they need no allocation to exist, so the hooks can read them at any time
+    thread_local int audioThreadDepth = 0;
+    thread_local bool isReporting = false;
+
+    std::atomic<int> numViolations { 0 };
+    std::atomic<bool> trapLocks { false };
+    std::atomic<bool> abortOnViolation { false };
+
+    void reportViolation(const char* what)
+    {
+        if (audioThreadDepth == 0 || isReporting)
+            return;
+
+        // Printing the backtrace allocates: anything it does must not be reported again
+        isReporting = true;
+        ++numViolations;
+
+        std::cerr << "Real-time safety violation on the audio thread: " << what << std::endl
+                  << juce::SystemStats::getStackBacktrace() << std::endl;
+
+        isReporting = false;
+
+        if (abortOnViolation.load())
+            std::abort();
+    }
+
+    void* rawAllocate(size_t size) noexcept
+    {
+       #if JUCE_LINUX
+        return __libc_malloc(size == 0 ? 1 : size);
+       #else
+        return std::malloc(size == 0 ? 1 : size);
+       #endif
+    }
+
+    void rawFree(void* ptr) noexcept
+    {
+       #if JUCE_LINUX
+        __libc_free(ptr);
+       #else
+        std::free(ptr);
+       #endif
+    }
+
+    // Over-aligned blocks, for the std::align_val_t overloads. Only Windows frees them differently.
+    void* rawAllocateAligned(size_t size, std::align_val_t alignment) noexcept
+    {
+        const size_t bytes = size == 0 ? 1 : size;
+        const size_t align = std::max((size_t)alignment, sizeof(void*));
+
+       #if JUCE_LINUX
+        return __libc_memalign(align, bytes);
+       #elif JUCE_WINDOWS
+        return _aligned_malloc(bytes, align);
+       #else
+        void* ptr = nullptr;
+        return posix_memalign(&ptr, align, bytes) == 0 ? ptr : nullptr;
+       #endif
+    }
+
+    void rawFreeAligned(void* ptr) noexcept
+    {
+       #if JUCE_WINDOWS
+        _aligned_free(ptr);
+       #else
+        rawFree(ptr);
+       #endif
+    }
+
+    void* checkedNew(size_t size)
+    {
+        reportViolation("operator new");
+
+        if (auto* ptr = rawAllocate(size))
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+
+    void* checkedNew(size_t size, std::align_val_t alignment)
+    {
+        reportViolation("aligned operator new");
+
+        if (auto* ptr = rawAllocateAligned(size, alignment))
+            return ptr;
+
+        throw std::bad_alloc();
+    }
+
+    void checkedDelete(void* ptr) noexcept
+    {
+        if (ptr != nullptr)
+            reportViolation("operator delete");
+
+        rawFree(ptr);
+    }
+
+    void checkedDelete(void* ptr, std::align_val_t) noexcept
+    {
+        if (ptr != nullptr)
+            reportViolation("aligned operator delete");
+
+        rawFreeAligned(ptr);
+    }
+}
+
+//==============================================================================
+namespace RealtimeSafety
+{
+    ScopedAudioThread::ScopedAudioThread() noexcept    { ++audioThreadDepth; }
+    ScopedAudioThread::~ScopedAudioThread() noexcept   { --audioThreadDepth; }
+
+    int getNumViolations() noexcept                     { return numViolations.load(); }
+    void resetViolations() noexcept                     { numViolations = 0; }
+    void setTrapLocks(bool shouldTrap) noexcept         { trapLocks = shouldTrap; }
+    void setAbortOnViolation(bool shouldAbort) noexcept { abortOnViolation = shouldAbort; }
+}
+
+//==============================================================================
+// Replacement allocation functions: every new and delete in the process goes through these
+void* operator new(size_t size)                                      { return checkedNew(size); }
+void* operator new[](size_t size)                                    { return checkedNew(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept      { reportViolation("operator new"); return rawAllocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept    { reportViolation("operator new[]"); return rawAllocate(size); }
+void operator delete(void* ptr) noexcept                             { checkedDelete(ptr); }
+void operator delete[](void* ptr) noexcept                           { checkedDelete(ptr); }
+void operator delete(void* ptr, size_t) noexcept                     { checkedDelete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept                   { checkedDelete(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept      { checkedDelete(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept    { checkedDelete(ptr); }
+
+// The over-aligned forms (alignas above the default new alignment): libstdc++ serves them from aligned_alloc,
+// not malloc, so they need their own replacements
+void* operator new(size_t size, std::align_val_t alignment)                                     { return checkedNew(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment)                                   { return checkedNew(size, alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept     { reportViolation("aligned operator new"); return rawAllocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept   { reportViolation("aligned operator new[]"); return rawAllocateAligned(size, alignment); }
+void operator delete(void* ptr, std::align_val_t alignment) noexcept                            { checkedDelete(ptr, alignment); }
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept                          { checkedDelete(ptr, alignment); }
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept                    { checkedDelete(ptr, alignment); }
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept                  { checkedDelete(ptr, alignment); }
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept     { checkedDelete(ptr, alignment); }
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept   { checkedDelete(ptr, alignment); }
+
+#if JUCE_LINUX
+//==============================================================================
+// The C allocator and the blocking pthread calls are interposed as well, so that
+// malloc from C code, std::mutex and juce::CriticalSection are caught too.
+extern "C"
+{
+    void* malloc(size_t size)
+    {
+        reportViolation("malloc");
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size)
+    {
+        reportViolation("calloc");
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, size_t size)
+    {
+        reportViolation("realloc");
+        return __libc_realloc(ptr, size);
+    }
+
+    void free(void* ptr)
+    {
+        if (ptr != nullptr)
+            reportViolation("free");
+
+        __libc_free(ptr);
+    }
+
+    // The aligned C allocations do not go through malloc either
+    void* aligned_alloc(size_t alignment, size_t size)
+    {
+        reportViolation("aligned_alloc");
+        return __libc_memalign(alignment, size);
+    }
+
+    void* memalign(size_t alignment, size_t size)
+    {
+        reportViolation("memalign");
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** ptr, size_t alignment, size_t size)
+    {
+        reportViolation("posix_memalign");
+
+        if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+            return EINVAL;
+
+        *ptr = __libc_memalign(alignment, size);
+        return *ptr != nullptr ? 0 : ENOMEM;
+    }
+}
+
+namespace
+{
+    // Looks up the next definition of a symbol once. No function-local static here:
+    // its initialisation guard could itself take the mutex being interposed.
+    template <typename Function>
+    Function getNextSymbol(std::atomic<Function>& cache, const char* name) noexcept
+    {
+        auto function = cache.load(std::memory_order_acquire);
+
+        if (function == nullptr)
+        {
+            function = reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+            cache.store(function, std::memory_order_release);
+        }
+
+        return function;
+    }
+
+    void reportLock(const char* what)
+    {
+        if (trapLocks.load(std::memory_order_relaxed))
+            reportViolation(what);
+    }
+
+    using MutexLockFunction = int (*)(pthread_mutex_t*);
+    using CondWaitFunction = int (*)(pthread_cond_t*, pthread_mutex_t*);
+    using NanosleepFunction = int (*)(const struct timespec*, struct timespec*);
+
+    std::atomic<MutexLockFunction> nextMutexLock { nullptr };
+    std::atomic<CondWaitFunction> nextCondWait { nullptr };
+    std::atomic<NanosleepFunction> nextNanosleep { nullptr };
+}
+
+extern "C"
+{
+    int pthread_mutex_lock(pthread_mutex_t* mutex)
+    {
+        reportLock("pthread_mutex_lock");
+        return getNextSymbol(nextMutexLock, "pthread_mutex_lock")(mutex);
+    }
+
+    int pthread_cond_wait(pthread_cond_t* condition, pthread_mutex_t* mutex)
+    {
+        reportLock("pthread_cond_wait");
+        return getNextSymbol(nextCondWait, "pthread_cond_wait")(condition, mutex);
+    }
+
+    int nanosleep(const struct timespec* duration, struct timespec* remaining)
+    {
+        reportLock("nanosleep");
+        return getNextSymbol(nextNanosleep, "nanosleep")(duration, remaining);
+    }
+}
+#endif // JUCE_LINUX
+
+#endif // FLANGER_RT_SAFETY_CHECKS
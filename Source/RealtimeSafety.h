@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    RealtimeSafety.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Debug/test instrumentation that reports any allocation, and optionally any
+    lock or blocking wait, made while a thread runs the audio callback.
+
+    It is compiled in only with FLANGER_RT_SAFETY_CHECKS=1, which replaces the
+    global allocation functions: enable it for test executables, never for the
+    shipped plugin. Otherwise ScopedAudioThread is an empty object.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef FLANGER_RT_SAFETY_CHECKS
+ #define FLANGER_RT_SAFETY_CHECKS 0
+#endif
+
+namespace RealtimeSafety
+{
+#if FLANGER_RT_SAFETY_CHECKS
+    // Marks the calling thread as running the audio callback while the object is alive
+    struct ScopedAudioThread
+    {
+        ScopedAudioThread() noexcept;
+        ~ScopedAudioThread() noexcept;
+    };
+
+    // Number of violations reported since the last reset, across all threads
+    int getNumViolations() noexcept;
+    void resetViolations() noexcept;
+
+    // Also report mutex locks, condition waits and sleeps (off by default)
+    void setTrapLocks(bool shouldTrap) noexcept;
+
+    // Abort on the first violation, e.g. to stop in a debugger (off by default)
+    void setAbortOnViolation(bool shouldAbort) noexcept;
+#else
+    struct ScopedAudioThread
+    {
+        ScopedAudioThread() noexcept {}
+    };
+#endif
+}
@@ -0,0 +1,248 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyser.h"
+
+#include <complex>
+
+constexpr int SpectrumAnalyser::kFftOrder;
+constexpr int SpectrumAnalyser::kFftSize;
+constexpr int SpectrumAnalyser::kFramesPerSecond;
+constexpr float SpectrumAnalyser::kMinimumFrequency;
+constexpr float SpectrumAnalyser::kMaximumFrequency;
+constexpr float SpectrumAnalyser::kSpectrumFloor;
+constexpr float SpectrumAnalyser::kCombRange;
+constexpr int SpectrumAnalyser::kFifoSize;
+
+namespace
+{
+    // How fast the spectrum falls back when the level drops, in dB per frame
+    const float kSpectrumFall = 1.5f;
+
+    // Points of the comb response evaluated per pixel
+    const int kCombStepsPerPixel = 8;
+
+    // Magnitude of a full-scale sine in a bin: half the FFT size, times the coherent gain of the Hann window
+    const float kFullScaleMagnitude = 0.5f * (float)SpectrumAnalyser::kFftSize * 0.5f;
+
+    const juce::Colour kBackgroundColour = juce::Colour(0xff303030);
+    const juce::Colour kGridColour = juce::Colours::white.withAlpha(0.15f);
+    const juce::Colour kSpectrumColour = juce::Colours::palevioletred;
+    const juce::Colour kCombColour = juce::Colours::pink;
+}
+
+//==============================================================================
+SpectrumAnalyser::SpectrumAnalyser()
+    : juce::Thread("Flanger spectrum"),
+      fifoData((size_t)kFifoSize),
+      history((size_t)kFftSize),
+      fftData((size_t)(2 * kFftSize)),
+      spectrum((size_t)(kFftSize / 2), kSpectrumFloor)
+{
+}
+
+SpectrumAnalyser::~SpectrumAnalyser()
+{
+    stop();
+}
+
+void SpectrumAnalyser::start()
+{
+    if (running)
+        return;
+
+    running = true;
+    startThread();
+}
+
+void SpectrumAnalyser::stop()
+{
+    running = false;
+    stopThread(1000);
+}
+
+void SpectrumAnalyser::setImageSize(int width, int height) noexcept
+{
+    imageWidth = width;
+    imageHeight = height;
+}
+
+void SpectrumAnalyser::setSampleRate(double newSampleRate) noexcept
+{
+    sampleRate = (float)newSampleRate;
+}
+
+void SpectrumAnalyser::pushSamples(const float* const* channels, int numChannels, int numSamples) noexcept
+{
+    if (! running.load(std::memory_order_relaxed) || numChannels < 1)
+        return;
+
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite(numSamples, start1, size1, start2, size2);
+
+    // Whatever does not fit is dropped: the worker has fallen behind, the next frame will catch up
+    const float scale = 1.0f / (float)numChannels;
+
+    auto mix = [&](int start, int size, int offset)
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            float sum = 0.0f;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                sum += channels[channel][offset + i];
+
+            fifoData[(size_t)(start + i)] = sum * scale;
+        }
+    };
+
+    mix(start1, size1, 0);
+    mix(start2, size2, size1);
+    fifo.finishedWrite(size1 + size2);
+}
+
+void SpectrumAnalyser::setCombParameters(float delay, float feedback, float gain) noexcept
+{
+    combDelay.store(delay, std::memory_order_relaxed);
+    combFeedback.store(feedback, std::memory_order_relaxed);
+    combGain.store(gain, std::memory_order_relaxed);
+}
+
+void SpectrumAnalyser::drawImage(juce::Graphics& g, juce::Rectangle<float> area)
+{
+    const juce::SpinLock::ScopedLockType lock(imageLock);
+
+    if (frontImage.isValid())
+        g.drawImage(frontImage, area);
+}
+
+//==============================================================================
+void SpectrumAnalyser::run()
+{
+    while (! threadShouldExit())
+    {
+        drainFifo();
+        analyse();
+        render();
+
+        wait(1000 / kFramesPerSecond);
+    }
+}
+
+void SpectrumAnalyser::drainFifo()
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+
+    auto copy = [this](int start, int size)
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            history[(size_t)historyPosition] = fifoData[(size_t)(start + i)];
+            historyPosition = (historyPosition + 1) % kFftSize;
+        }
+    };
+
+    copy(start1, size1);
+    copy(start2, size2);
+    fifo.finishedRead(size1 + size2);
+}
+
+void SpectrumAnalyser::analyse()
+{
+    // Oldest sample first
+    std::copy(history.begin() + historyPosition, history.end(), fftData.begin());
+    std::copy(history.begin(), history.begin() + historyPosition, fftData.begin() + (kFftSize - historyPosition));
+    std::fill(fftData.begin() + kFftSize, fftData.end(), 0.0f);
+
+    window.multiplyWithWindowingTable(fftData.data(), (size_t)kFftSize);
+    fft.performFrequencyOnlyForwardTransform(fftData.data());
+
+    for (size_t bin = 0; bin < spectrum.size(); ++bin)
+    {
+        const float level = juce::Decibels::gainToDecibels(fftData[bin] / kFullScaleMagnitude, kSpectrumFloor);
+        spectrum[bin] = juce::jmax(level, spectrum[bin] - kSpectrumFall);
+    }
+}
+
+void SpectrumAnalyser::render()
+{
+    const int width = imageWidth.load();
+    const int height = imageHeight.load();
+
+    if (width < 1 || height < 1)
+        return;
+
+    // Software images, which can be drawn into from any thread
+    if (backImage.getWidth() != width || backImage.getHeight() != height)
+        backImage = juce::Image(juce::Image::ARGB, width, height, false, juce::SoftwareImageType());
+
+    const float rate = sampleRate.load();
+    const float delay = combDelay.load(std::memory_order_relaxed);
+    const float feedback = combFeedback.load(std::memory_order_relaxed);
+    const float gain = combGain.load(std::memory_order_relaxed);
+    const float top = 0.0f;
+    const float bottom = (float)height;
+    const float octaves = std::log2(kMaximumFrequency / kMinimumFrequency);
+
+    juce::Graphics g(backImage);
+    g.fillAll(kBackgroundColour);
+
+    // One line per decade
+    g.setColour(kGridColour);
+
+    for (float frequency = 100.0f; frequency < kMaximumFrequency; frequency *= 10.0f)
+        g.drawVerticalLine(juce::roundToInt((float)width * std::log2(frequency / kMinimumFrequency) / octaves), top, bottom);
+
+    g.drawHorizontalLine(height / 2, 0.0f, (float)width);
+
+    juce::Path spectrumPath, combPath;
+    spectrumPath.startNewSubPath(0.0f, bottom);
+
+    for (int x = 0; x < width; ++x)
+    {
+        const float frequency = kMinimumFrequency * std::exp2(octaves * (float)x / (float)width);
+
+        // Spectrum, linearly interpolated between the bins
+        const float position = juce::jlimit(0.0f, (float)(spectrum.size() - 2), frequency * (float)kFftSize / rate);
+        const int bin = (int)position;
+        const float level = spectrum[(size_t)bin] + (position - (float)bin) * (spectrum[(size_t)bin + 1] - spectrum[(size_t)bin]);
+        spectrumPath.lineTo((float)x, juce::jmap(level, kSpectrumFloor, 0.0f, bottom, top));
+
+        // Comb: H = 1 + gain * z^-D / (1 - feedback * z^-D), several points per pixel so that the notches,
+        // closer than a pixel at high frequencies, fill the area they sweep instead of aliasing
+        for (int step = 0; step < kCombStepsPerPixel; ++step)
+        {
+            const float subX = (float)x + (float)step / (float)kCombStepsPerPixel;
+            const float subFrequency = kMinimumFrequency * std::exp2(octaves * subX / (float)width);
+            const auto delayed = std::polar(1.0f, -juce::MathConstants<float>::twoPi * subFrequency * delay);
+            const auto response = 1.0f + gain * delayed / (1.0f - feedback * delayed);
+            const float combLevel = juce::jlimit(-kCombRange, kCombRange, juce::Decibels::gainToDecibels(std::abs(response), -kCombRange));
+            const float y = juce::jmap(combLevel, -kCombRange, kCombRange, bottom, top);
+
+            if (x == 0 && step == 0)
+                combPath.startNewSubPath(subX, y);
+            else
+                combPath.lineTo(subX, y);
+        }
+    }
+
+    spectrumPath.lineTo((float)width, bottom);
+    spectrumPath.closeSubPath();
+
+    g.setColour(kSpectrumColour.withAlpha(0.5f));
+    g.fillPath(spectrumPath);
+
+    g.setColour(kCombColour);
+    g.strokePath(combPath, juce::PathStrokeType(1.5f));
+
+    const juce::SpinLock::ScopedLockType lock(imageLock);
+    std::swap(frontImage, backImage);
+}
@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+    Output spectrum and comb-filter response, computed on a worker thread.
+
+    The audio thread only copies the output (mixed to mono) into a lock-free
+    FIFO and stores the delay, feedback and gain in atomics. The worker drains
+    the FIFO, runs the FFT, evaluates the analytic response of the comb and
+    draws both into an image, about kFramesPerSecond times per second. The
+    editor only draws the last finished image.
+
+    The worker runs while a SpectrumDisplay is open; otherwise pushSamples()
+    returns straight away.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <atomic>
+#include <vector>
+
+//==============================================================================
+class SpectrumAnalyser  : private juce::Thread
+{
+public:
+    SpectrumAnalyser();
+    ~SpectrumAnalyser() override;
+
+    // Message thread: the display starts the worker when it opens and stops it when it closes
+    void start();
+    void stop();
+    bool isRunning() const noexcept { return running.load(std::memory_order_relaxed); }
+
+    // Size of the images drawn by the worker, in pixels
+    void setImageSize(int width, int height) noexcept;
+
+    void setSampleRate(double sampleRate) noexcept;
+
+    // Audio thread: the output of a block, dropped if the worker is not running or has fallen behind
+    void pushSamples(const float* const* channels, int numChannels, int numSamples) noexcept;
+
+    // Audio thread: the comb shown is y = x + gain * w[n - D], w = x + feedback * w[n - D], D = delay (in s)
+    void setCombParameters(float delay, float feedback, float gain) noexcept;
+
+    // Message thread: draws the last finished image, or nothing before the first one
+    void drawImage(juce::Graphics& g, juce::Rectangle<float> area);
+
+    static constexpr int kFftOrder = 11;
+    static constexpr int kFftSize = 1 << kFftOrder;
+    static constexpr int kFramesPerSecond = 30;
+
+    // Frequency axis of the image, logarithmic
+    static constexpr float kMinimumFrequency = 20.0f;
+    static constexpr float kMaximumFrequency = 20000.0f;
+
+    // Vertical ranges of the image: spectrum in dBFS, comb response in dB around 0
+    static constexpr float kSpectrumFloor = -90.0f;
+    static constexpr float kCombRange = 30.0f;
+
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyser)
+
+    void run() override;
+
+    // Worker: moves the FIFO into the history, the last kFftSize samples
+    void drainFifo();
+    // Worker: FFT of the history into the smoothed spectrum
+    void analyse();
+    // Worker: draws into backImage, then swaps it with frontImage
+    void render();
+
+    // Single producer (the audio thread), single consumer (the worker)
+    static constexpr int kFifoSize = 4 * kFftSize;
+    juce::AbstractFifo fifo { kFifoSize };
+    std::vector<float> fifoData;
+
+    std::vector<float> history;
+    int historyPosition = 0;
+
+    juce::dsp::FFT fft { kFftOrder };
+    juce::dsp::WindowingFunction<float> window { (size_t)kFftSize, juce::dsp::WindowingFunction<float>::hann, false };
+    std::vector<float> fftData;
+    std::vector<float> spectrum;    // dBFS per bin, falling slowly
+
+    std::atomic<bool> running { false };
+    std::atomic<float> sampleRate { 44100.0f };
+    std::atomic<float> combDelay { 0.015f };
+    std::atomic<float> combFeedback { 0.5f };
+    std::atomic<float> combGain { 1.0f };
+    std::atomic<int> imageWidth { 0 };
+    std::atomic<int> imageHeight { 0 };
+
+    // The worker draws into backImage; the swap and the editor's drawing hold the lock
+    juce::Image frontImage, backImage;
+    juce::SpinLock imageLock;
+};
@@ -0,0 +1,57 @@
+/*
+  ==============================================================================
+
+    SpectrumDisplay.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "SpectrumDisplay.h"
+
+//==============================================================================
+SpectrumDisplay::SpectrumDisplay(SpectrumAnalyser& a)
+    : analyser(a)
+{
+    setOpaque(true);
+    analyser.start();
+    startTimerHz(SpectrumAnalyser::kFramesPerSecond);
+}
+
+SpectrumDisplay::~SpectrumDisplay()
+{
+    stopTimer();
+    analyser.stop();
+}
+
+void SpectrumDisplay::paint (juce::Graphics& g)
+{
+    g.fillAll(juce::Colours::darkgrey);
+    analyser.drawImage(g, getLocalBounds().toFloat());
+
+    // Decade labels, on the lines drawn by the analyser
+    const float octaves = std::log2(SpectrumAnalyser::kMaximumFrequency / SpectrumAnalyser::kMinimumFrequency);
+    g.setColour(juce::Colours::white.withAlpha(0.6f));
+    g.setFont(11.0f);
+
+    for (float frequency = 100.0f; frequency < SpectrumAnalyser::kMaximumFrequency; frequency *= 10.0f)
+    {
+        const int x = juce::roundToInt((float)getWidth() * std::log2(frequency / SpectrumAnalyser::kMinimumFrequency) / octaves);
+        g.drawText(frequency < 1000.0f ? juce::String((int)frequency) : juce::String((int)frequency / 1000) + "k",
+                   x + 2, getHeight() - 14, 30, 12, juce::Justification::left);
+    }
+
+    g.drawText("comb: +/-" + juce::String((int)SpectrumAnalyser::kCombRange) + " dB", 4, 2, 120, 12, juce::Justification::left);
+}
+
+void SpectrumDisplay::resized()
+{
+    analyser.setImageSize(getWidth(), getHeight());
+}
+
+void SpectrumDisplay::timerCallback()
+{
+    repaint();
+}
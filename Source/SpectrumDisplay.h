@@ -0,0 +1,38 @@
+/*
+  ==============================================================================
+
+    SpectrumDisplay.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SpectrumAnalyser.h"
+
+//==============================================================================
+/*
+    Output spectrum (filled) and comb-filter response (line) of the flanger.
+    The analyser draws them on its own thread; this only draws its last image
+    and the labels of the axes. The analyser runs while the display exists.
+*/
+class SpectrumDisplay  : public juce::Component,
+                         private juce::Timer
+{
+public:
+    SpectrumDisplay(SpectrumAnalyser& analyser);
+    ~SpectrumDisplay() override;
+
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumDisplay)
+
+    void timerCallback() override;
+
+    SpectrumAnalyser& analyser;
+};
@@ -0,0 +1,125 @@
+/*
+  ==============================================================================
+
+    WavetableEditor.cpp
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "WavetableEditor.h"
+#include "PluginProcessor.h"
+
+//==============================================================================
+WavetableEditor::WavetableEditor(FlangerAudioProcessor& p): audioProcessor(p)
+{
+    points = audioProcessor.getWavetablePoints();
+
+    // Slew of the random shape: 0 steps, 1 glides over the whole period
+    slewSlider.setSliderStyle(juce::Slider::RotaryHorizontalVerticalDrag);
+    slewSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 80, 20);
+
+    slewLabel.setText("Random slew", juce::dontSendNotification);
+    slewLabel.setJustificationType(juce::Justification::centred);
+
+    addAndMakeVisible(slewSlider);
+    addAndMakeVisible(slewLabel);
+
+    // Parameters
+    slewCall = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.apvts, "SLEW", slewSlider);
+}
+
+WavetableEditor::~WavetableEditor()
+{
+}
+
+void WavetableEditor::paint (juce::Graphics& g)
+{
+    g.fillAll (juce::Colours::dimgrey);   // clear the background
+
+    g.setColour(juce::Colours::darkgrey);
+    g.fillRect(drawArea);
+
+    g.setColour(juce::Colours::white);
+    g.setFont(12.0f);
+    g.drawText("Custom LFO shape", drawArea.reduced(4.0f), juce::Justification::topLeft);
+
+    // One period, closed back onto the first point as the LFO wraps
+    juce::Path curve;
+    const int numPoints = points.size();
+
+    for (int i = 0; i <= numPoints; ++i)
+    {
+        const float x = drawArea.getX() + drawArea.getWidth() * (float)i / (float)numPoints;
+        const float y = drawArea.getBottom() - drawArea.getHeight() * points[i % numPoints];
+
+        if (i == 0)
+            curve.startNewSubPath(x, y);
+        else
+            curve.lineTo(x, y);
+    }
+
+    g.setColour(juce::Colours::palevioletred);
+    g.strokePath(curve, juce::PathStrokeType(2.0f));
+
+    // Slider colors
+    getLookAndFeel().setColour(juce::Slider::thumbColourId, juce::Colours::pink);
+    getLookAndFeel().setColour(juce::Slider::rotarySliderFillColourId, juce::Colours::palevioletred);
+}
+
+void WavetableEditor::resized()
+{
+    auto bounds = getLocalBounds().reduced(4);
+    auto slewBounds = bounds.removeFromRight(100);
+
+    slewLabel.setBounds(slewBounds.removeFromTop(20));
+    slewSlider.setBounds(slewBounds);
+
+    drawArea = bounds.reduced(4).toFloat();
+}
+
+void WavetableEditor::mouseDown (const juce::MouseEvent& event)
+{
+    lastDrawnPoint = -1;
+    drawPoint(event.position);
+}
+
+void WavetableEditor::mouseDrag (const juce::MouseEvent& event)
+{
+    drawPoint(event.position);
+}
+
+void WavetableEditor::mouseUp (const juce::MouseEvent&)
+{
+    // Publish the new shape once per stroke: each call builds a table for the audio thread
+    if (lastDrawnPoint >= 0)
+        audioProcessor.setWavetablePoints(points);
+
+    lastDrawnPoint = -1;
+}
+
+void WavetableEditor::drawPoint(juce::Point<float> position)
+{
+    if (drawArea.isEmpty() || points.isEmpty())
+        return;
+
+    const int numPoints = points.size();
+    const int index = juce::jlimit(0, numPoints - 1, (int)((position.x - drawArea.getX()) / drawArea.getWidth() * (float)numPoints));
+    const float value = juce::jlimit(0.0f, 1.0f, (drawArea.getBottom() - position.y) / drawArea.getHeight());
+
+    // Fast drags skip points, so fill the gap with a straight line
+    const int from = lastDrawnPoint >= 0 ? lastDrawnPoint : index;
+    const float fromValue = points[from];
+    const int step = index >= from ? 1 : -1;
+
+    for (int i = from; i != index + step; i += step)
+    {
+        const float t = index == from ? 1.0f : (float)(i - from) / (float)(index - from);
+        points.set(i, fromValue + t * (value - fromValue));
+    }
+
+    lastDrawnPoint = index;
+    repaint();
+}
@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    WavetableEditor.h
+    Created: 19 Oct 2026
+    Author:  BeetleJUCE
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/*
+    Drawing area for the user-defined LFO shape (the "Custom" wave): click or
+    drag to move the points of one period. Next to it, the slew of the
+    random LFO shape.
+*/
+class WavetableEditor  : public juce::Component
+{
+public:
+    WavetableEditor(FlangerAudioProcessor& p);
+    ~WavetableEditor() override;
+
+    void paint (juce::Graphics&) override;
+    void resized() override;
+
+    void mouseDown (const juce::MouseEvent&) override;
+    void mouseDrag (const juce::MouseEvent&) override;
+    void mouseUp (const juce::MouseEvent&) override;
+
+private:
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WavetableEditor)
+
+    // Moves the point under the mouse, and the ones skipped since the last drag event
+    void drawPoint(juce::Point<float> position);
+
+    FlangerAudioProcessor& audioProcessor;
+
+    juce::Array<float> points;
+    juce::Rectangle<float> drawArea;
+    int lastDrawnPoint = -1;
+
+    juce::Slider slewSlider;
+    juce::Label slewLabel;
+
+public:
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> slewCall;
+
+};